@@ -446,6 +446,28 @@ nsresult AttrArray::EnsureCapacityToClone(const AttrArray& aOther) {
   return NS_OK;
 }
 
+nsresult AttrArray::EnsureCapacityForNewAttrs(uint32_t aAttrCount) {
+  if (mImpl || !aAttrCount) {
+    return NS_OK;
+  }
+
+  CheckedUint32 sizeInBytes = aAttrCount;
+  sizeInBytes *= sizeof(InternalAttr);
+  sizeInBytes += sizeof(Impl);
+  if (!sizeInBytes.isValid()) {
+    return NS_ERROR_OUT_OF_MEMORY;
+  }
+
+  mImpl.reset(static_cast<Impl*>(malloc(sizeInBytes.value())));
+  NS_ENSURE_TRUE(mImpl, NS_ERROR_OUT_OF_MEMORY);
+
+  mImpl->mMappedAttrs = nullptr;
+  mImpl->mCapacity = aAttrCount;
+  mImpl->mAttrCount = 0;
+
+  return NS_OK;
+}
+
 bool AttrArray::GrowBy(uint32_t aGrowSize) {
   const uint32_t kLinearThreshold = 16;
   const uint32_t kLinearGrowSize = 4;
@@ -120,6 +120,12 @@ class AttrArray {
   // unmapped attributes of |aOther|.
   nsresult EnsureCapacityToClone(const AttrArray& aOther);
 
+  // Allocates an exactly sized buffer for up to |aAttrCount| attributes, if
+  // the array doesn't have a buffer yet. For callers that know how many
+  // attributes they are about to set, so that elements with one or two
+  // attributes don't get the default linear growth step.
+  nsresult EnsureCapacityForNewAttrs(uint32_t aAttrCount);
+
   struct InternalAttr {
     nsAttrName mName;
     nsAttrValue mValue;
@@ -474,13 +474,13 @@ nsresult BodyUtil::ConsumeText(uint32_t aInputLength, uint8_t* aInput,
   return NS_OK;
 }
 
-// static
-void BodyUtil::ConsumeJson(JSContext* aCx, JS::MutableHandle<JS::Value> aValue,
-                           const nsString& aStr, ErrorResult& aRv) {
+template <typename CharT>
+static void ParseJson(JSContext* aCx, JS::MutableHandle<JS::Value> aValue,
+                      const CharT* aChars, uint32_t aLength, ErrorResult& aRv) {
   aRv.MightThrowJSException();
 
   JS::Rooted<JS::Value> json(aCx);
-  if (!JS_ParseJSON(aCx, aStr.get(), aStr.Length(), &json)) {
+  if (!JS_ParseJSON(aCx, aChars, aLength, &json)) {
     if (!JS_IsExceptionPending(aCx)) {
       aRv.Throw(NS_ERROR_DOM_UNKNOWN_ERR);
       return;
@@ -498,5 +498,35 @@ void BodyUtil::ConsumeJson(JSContext* aCx, JS::MutableHandle<JS::Value> aValue,
   aValue.set(json);
 }
 
+// static
+void BodyUtil::ConsumeJson(JSContext* aCx, JS::MutableHandle<JS::Value> aValue,
+                           const nsString& aStr, ErrorResult& aRv) {
+  ParseJson(aCx, aValue, aStr.get(), aStr.Length(), aRv);
+}
+
+// static
+void BodyUtil::ConsumeJson(JSContext* aCx, JS::MutableHandle<JS::Value> aValue,
+                           uint32_t aInputLength, uint8_t* aInput,
+                           ErrorResult& aRv) {
+  // ASCII is a subset of both UTF-8 and Latin-1, and can't contain a BOM, so
+  // ASCII-only input can be parsed directly. This avoids a UTF-16 copy twice
+  // the size of the input, and the strings in the result stay Latin-1.
+  auto input = MakeSpan(aInput, aInputLength);
+  if (Encoding::ASCIIValidUpTo(input) == aInputLength) {
+    ParseJson(aCx, aValue, reinterpret_cast<const JS::Latin1Char*>(aInput),
+              aInputLength, aRv);
+    return;
+  }
+
+  nsString decoded;
+  nsresult rv = ConsumeText(aInputLength, aInput, decoded);
+  if (NS_FAILED(rv)) {
+    aRv.Throw(rv);
+    return;
+  }
+
+  ConsumeJson(aCx, aValue, decoded, aRv);
+}
+
 }  // namespace dom
 }  // namespace mozilla
@@ -63,6 +63,16 @@ class BodyUtil final {
    */
   static void ConsumeJson(JSContext* aCx, JS::MutableHandle<JS::Value> aValue,
                           const nsString& aStr, ErrorResult& aRv);
+
+  /**
+   * Parses the UTF-8 encoded |aInput| as JSON, assigning the result to
+   * |aValue|. ASCII-only input is handed to the JS engine as is, without
+   * being decoded to UTF-16 first. The caller may free |aInput| once this
+   * method returns.
+   */
+  static void ConsumeJson(JSContext* aCx, JS::MutableHandle<JS::Value> aValue,
+                          uint32_t aInputLength, uint8_t* aInput,
+                          ErrorResult& aRv);
 };
 
 }  // namespace dom
@@ -727,6 +727,15 @@ class Element : public FragmentOrElement {
    */
   nsresult SetSingleClassFromParser(nsAtom* aSingleClassName);
 
+  /**
+   * Preallocates attribute storage for an element the parser is about to set
+   * aAttrCount attributes on. Does nothing if the element already has
+   * attribute storage.
+   */
+  nsresult EnsureAttrCapacityFromParser(uint32_t aAttrCount) {
+    return mAttrs.EnsureCapacityForNewAttrs(aAttrCount);
+  }
+
   // aParsedValue receives the old value of the attribute. That's useful if
   // either the input or output value of aParsedValue is StoresOwnData.
   nsresult SetParsedAttr(int32_t aNameSpaceID, nsAtom* aName, nsAtom* aPrefix,
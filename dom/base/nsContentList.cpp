@@ -697,14 +697,56 @@ void nsContentList::ContentRemoved(nsIContent* aChild,
                                    nsIContent* aPreviousSibling) {
   if (mState != LIST_DIRTY &&
       MayContainRelevantNodes(aChild->GetParentNode()) &&
-      nsContentUtils::IsInSameAnonymousTree(mRootNode, aChild) &&
-      MatchSelf(aChild)) {
-    SetDirty();
+      nsContentUtils::IsInSameAnonymousTree(mRootNode, aChild)) {
+    RemoveMatchingSubtree(aChild);
   }
 
   ASSERT_IN_SYNC;
 }
 
+void nsContentList::RemoveMatchingSubtree(nsIContent* aContent) {
+  // Find the first element in the removed subtree that we match.
+  Element* first = nullptr;
+  if (aContent->IsElement() && Match(aContent->AsElement())) {
+    first = aContent->AsElement();
+  } else if (mDeep) {
+    for (nsIContent* cur = aContent->GetFirstChild(); cur;
+         cur = cur->GetNextNode(aContent)) {
+      if (cur->IsElement() && Match(cur->AsElement())) {
+        first = cur->AsElement();
+        break;
+      }
+    }
+  }
+
+  if (!first) {
+    return;
+  }
+
+  // Our elements are in tree order, so everything we hold from the removed
+  // subtree is a contiguous run starting at |first|.  Drop just that run
+  // rather than throwing away the whole list.
+  size_t start = mElements.IndexOf(first);
+  if (start == mElements.NoIndex) {
+    // A lazy list that hasn't got as far as the removed subtree yet has
+    // nothing to drop.
+    if (mState != LIST_LAZY) {
+      SetDirty();
+    }
+    return;
+  }
+
+  size_t end = start + 1;
+  if (mDeep) {
+    while (end < mElements.Length() &&
+           nsContentUtils::ContentIsDescendantOf(mElements[end], aContent)) {
+      ++end;
+    }
+  }
+
+  mElements.RemoveElementsAt(start, end - start);
+}
+
 bool nsContentList::Match(Element* aElement) {
   if (mFunc) {
     return (*mFunc)(aElement, mMatchNameSpaceId, mXMLMatchAtom, mData);
@@ -372,6 +372,14 @@ class nsContentList : public nsBaseContentList,
    */
   bool MatchSelf(nsIContent* aContent);
 
+  /**
+   * Remove from our list whatever elements we hold from the subtree rooted
+   * at aContent, which is being removed from the tree.
+   *
+   * @param  aContent the root of the removed subtree
+   */
+  void RemoveMatchingSubtree(nsIContent* aContent);
+
   /**
    * Populate our list.  Stop once we have at least aNeededLength
    * elements.  At the end of PopulateSelf running, either the last
@@ -1318,6 +1318,7 @@ struct CycleCollectorStats {
     }
 
     uint32_t sliceTime = TimeBetween(mBeginSliceTime, mEndSliceTime);
+    Telemetry::Accumulate(Telemetry::CYCLE_COLLECTOR_SLICE_TIME, sliceTime);
     mMaxSliceTime = std::max(mMaxSliceTime, sliceTime);
     mMaxSliceTimeSinceClear = std::max(mMaxSliceTimeSinceClear, sliceTime);
     mTotalSliceTime += sliceTime;
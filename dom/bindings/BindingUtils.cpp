@@ -2657,6 +2657,15 @@ bool NonVoidByteStringToJsval(JSContext* cx, const nsACString& str,
 void NormalizeUSVString(nsAString& aString) { EnsureUTF16Validity(aString); }
 
 void NormalizeUSVString(binding_detail::FakeString& aString) {
+  // aString may share a read-only buffer with a DOM string, so only make it
+  // writable if there is actually something to fix up.
+  if (UTF16ValidUpTo(MakeSpan(aString.Data(), aString.Length())) ==
+      aString.Length()) {
+    return;
+  }
+  if (!aString.EnsureMutable()) {
+    NS_ABORT_OOM(aString.Length() * sizeof(char16_t));
+  }
   EnsureUTF16ValiditySpan(aString);
 }
 
@@ -2694,12 +2703,16 @@ bool ConvertJSValueToByteString(JSContext* cx, JS::Handle<JS::Value> v,
         return false;
       }
 
-      for (size_t i = 0; i < length; i++) {
-        if (chars[i] > 255) {
-          badCharIndex = i;
-          badChar = chars[i];
-          foundBadChar = true;
-          break;
+      // Check the whole string with the vectorized helper first, and only
+      // walk it a character at a time to find the bad one for the error.
+      if (!IsUTF16Latin1(MakeSpan(chars, length))) {
+        for (size_t i = 0; i < length; i++) {
+          if (chars[i] > 255) {
+            badCharIndex = i;
+            badChar = chars[i];
+            foundBadChar = true;
+            break;
+          }
         }
       }
     }
@@ -1828,6 +1828,31 @@ bool AppendNamedPropertyIds(JSContext* cx, JS::Handle<JSObject*> proxy,
 
 enum StringificationBehavior { eStringify, eEmpty, eNull };
 
+// If aString is an external string wrapping the nsStringBuffer of a DOM string
+// that XPCStringConvert handed to JS, returns that buffer so that it can be
+// shared rather than copied.  Returns null otherwise.
+inline nsStringBuffer* GetSharedDOMStringBuffer(JSString* aString) {
+  if (!XPCStringConvert::IsDOMString(aString)) {
+    return nullptr;
+  }
+  const char16_t* chars = JS_GetTwoByteExternalStringChars(aString);
+  if (chars[JS::GetStringLength(aString)] != '\0') {
+    return nullptr;
+  }
+  return nsStringBuffer::FromData(const_cast<char16_t*>(chars));
+}
+
+inline void AssignSharedDOMStringBuffer(nsStringBuffer* aBuffer,
+                                        uint32_t aLength, nsAString& aResult) {
+  aBuffer->ToString(aLength, aResult);
+}
+
+inline void AssignSharedDOMStringBuffer(nsStringBuffer* aBuffer,
+                                        uint32_t aLength,
+                                        binding_detail::FakeString& aResult) {
+  aResult.ShareStringBuffer(aBuffer, aLength);
+}
+
 template <typename T>
 static inline bool ConvertJSValueToString(
     JSContext* cx, JS::Handle<JS::Value> v,
@@ -1861,6 +1886,13 @@ static inline bool ConvertJSValueToString(
     }
   }
 
+  // Strings that came from the DOM in the first place, e.g. a textContent
+  // being passed back into another DOM API, can reuse their buffer.
+  if (nsStringBuffer* buffer = GetSharedDOMStringBuffer(s)) {
+    AssignSharedDOMStringBuffer(buffer, JS::GetStringLength(s), result);
+    return true;
+  }
+
   return AssignJSString(cx, result, s);
 }
 
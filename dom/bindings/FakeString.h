@@ -48,6 +48,35 @@ struct FakeString {
     }
   }
 
+  // Share aBuffer, which must hold aLength characters followed by a null
+  // terminator.  The characters must not be modified through BeginWriting()
+  // afterwards unless EnsureMutable() is called first.
+  void ShareStringBuffer(nsStringBuffer* aBuffer, nsString::size_type aLength) {
+    RefPtr<nsStringBuffer> buffer = aBuffer;
+    AssignFromStringBuffer(buffer.forget());
+    mLength = aLength;
+  }
+
+  // Make sure BeginWriting() can be used, by copying our characters out of a
+  // buffer that is shared with some other string.
+  bool EnsureMutable() {
+    if (!(mDataFlags & nsString::DataFlags::REFCOUNTED) ||
+        !nsStringBuffer::FromData(mData)->IsReadonly()) {
+      return true;
+    }
+    RefPtr<nsStringBuffer> shared =
+        dont_AddRef(nsStringBuffer::FromData(mData));
+    const nsString::char_type* sharedData = mData;
+    mDataFlags = nsString::DataFlags::TERMINATED;
+    if (!SetLength(mLength, mozilla::fallible)) {
+      // Keep the shared buffer, so that we're still a valid string.
+      AssignFromStringBuffer(shared.forget());
+      return false;
+    }
+    memcpy(mData, sharedData, mLength * sizeof(nsString::char_type));
+    return true;
+  }
+
   void Truncate() {
     MOZ_ASSERT(mDataFlags == nsString::DataFlags::TERMINATED);
     mData = nsString::char_traits::sEmptyBuffer;
@@ -724,12 +724,12 @@ nsresult FetchDriver::HttpFetch(
     }
   } else {
     // Integrity check cannot be done on alt-data yet.
-    if (mRequest->GetIntegrity().IsEmpty()) {
+    const nsCString& wasmAltDataType = FetchUtil::WasmAltDataType();
+    if (mRequest->GetIntegrity().IsEmpty() && !wasmAltDataType.IsEmpty()) {
       nsCOMPtr<nsICacheInfoChannel> cic = do_QueryInterface(chan);
       if (cic) {
         cic->PreferAlternativeDataType(
-            NS_LITERAL_CSTRING(WASM_ALT_DATA_TYPE_V1),
-            NS_LITERAL_CSTRING(WASM_CONTENT_TYPE), false);
+            wasmAltDataType, NS_LITERAL_CSTRING(WASM_CONTENT_TYPE), false);
       }
     }
 
@@ -962,8 +962,8 @@ FetchDriver::OnStartRequest(nsIRequest* aRequest) {
       }
     } else if (!cic->PreferredAlternativeDataTypes().IsEmpty()) {
       MOZ_ASSERT(cic->PreferredAlternativeDataTypes().Length() == 1);
-      MOZ_ASSERT(cic->PreferredAlternativeDataTypes()[0].type().EqualsLiteral(
-          WASM_ALT_DATA_TYPE_V1));
+      MOZ_ASSERT(cic->PreferredAlternativeDataTypes()[0].type().Equals(
+          FetchUtil::WasmAltDataType()));
       MOZ_ASSERT(
           cic->PreferredAlternativeDataTypes()[0].contentType().EqualsLiteral(
               WASM_CONTENT_TYPE));
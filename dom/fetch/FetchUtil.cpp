@@ -7,7 +7,14 @@
 #include "FetchUtil.h"
 
 #include "nsError.h"
+#include "nsIAsyncOutputStream.h"
+#include "nsICacheInfoChannel.h"
+#include "nsProxyRelease.h"
 #include "nsString.h"
+#include "js/BuildId.h"
+#include "mozilla/ClearOnShutdown.h"
+#include "mozilla/ScopeExit.h"
+#include "mozilla/StaticPtr.h"
 #include "mozilla/dom/Document.h"
 
 #include "mozilla/dom/InternalRequest.h"
@@ -302,31 +309,87 @@ class WorkerStreamOwner final {
   RefPtr<WeakWorkerRef> mWorkerRef;
 };
 
-class JSStreamConsumer final : public nsIInputStreamCallback {
+static void StoreWasmAltData(
+    const nsMainThreadPtrHandle<nsICacheInfoChannel>& aCache,
+    const JS::OptimizedEncodingBytes& aBytes) {
+  MOZ_ASSERT(NS_IsMainThread());
+
+  const nsCString& altDataType = FetchUtil::WasmAltDataType();
+  if (altDataType.IsEmpty()) {
+    return;
+  }
+
+  nsCOMPtr<nsIAsyncOutputStream> stream;
+  nsresult rv = aCache->OpenAlternativeOutputStream(
+      altDataType, int64_t(aBytes.length()), getter_AddRefs(stream));
+  if (NS_FAILED(rv)) {
+    return;
+  }
+
+  // A partially written entry must be doomed, so always report how the write
+  // went when closing the stream.
+  auto closeStream = MakeScopeExit([&]() { stream->CloseWithStatus(rv); });
+
+  const char* cursor = reinterpret_cast<const char*>(aBytes.begin());
+  uint32_t remaining = aBytes.length();
+  while (remaining) {
+    uint32_t written = 0;
+    rv = stream->Write(cursor, remaining, &written);
+    if (NS_FAILED(rv)) {
+      return;
+    }
+    if (!written) {
+      rv = NS_ERROR_FAILURE;
+      return;
+    }
+    cursor += written;
+    remaining -= written;
+  }
+}
+
+class JSStreamConsumer final : public nsIInputStreamCallback,
+                               public JS::OptimizedEncodingListener {
   nsCOMPtr<nsIEventTarget> mOwningEventTarget;
   RefPtr<WindowStreamOwner> mWindowStreamOwner;
   RefPtr<WorkerStreamOwner> mWorkerStreamOwner;
+  // If set, the stream is the original bytecode of a response that has a
+  // cache entry which can hold the compiled code once it is available.
+  nsMainThreadPtrHandle<nsICacheInfoChannel> mCache;
+  // If true, the stream is a previously stored optimized encoding which is
+  // buffered in full before being handed to the consumer.
+  const bool mOptimizedEncoding;
+  JS::OptimizedEncodingBytes mOptimizedEncodingBytes;
   JS::StreamConsumer* mConsumer;
   bool mConsumerAborted;
 
   JSStreamConsumer(already_AddRefed<WindowStreamOwner> aWindowStreamOwner,
-                   nsIGlobalObject* aGlobal, JS::StreamConsumer* aConsumer)
+                   nsIGlobalObject* aGlobal, JS::StreamConsumer* aConsumer,
+                   const nsMainThreadPtrHandle<nsICacheInfoChannel>& aCache,
+                   bool aOptimizedEncoding)
       : mOwningEventTarget(aGlobal->EventTargetFor(TaskCategory::Other)),
         mWindowStreamOwner(aWindowStreamOwner),
+        mCache(aCache),
+        mOptimizedEncoding(aOptimizedEncoding),
         mConsumer(aConsumer),
         mConsumerAborted(false) {
     MOZ_DIAGNOSTIC_ASSERT(mWindowStreamOwner);
     MOZ_DIAGNOSTIC_ASSERT(mConsumer);
+    MOZ_DIAGNOSTIC_ASSERT(!(mCache != nullptr && mOptimizedEncoding));
   }
 
   JSStreamConsumer(RefPtr<WorkerStreamOwner> aWorkerStreamOwner,
-                   nsIGlobalObject* aGlobal, JS::StreamConsumer* aConsumer)
+                   nsIGlobalObject* aGlobal, JS::StreamConsumer* aConsumer,
+                   const nsMainThreadPtrHandle<nsICacheInfoChannel>& aCache,
+                   bool aOptimizedEncoding)
       : mOwningEventTarget(aGlobal->EventTargetFor(TaskCategory::Other)),
         mWorkerStreamOwner(std::move(aWorkerStreamOwner)),
+        mCache(aCache),
+        mOptimizedEncoding(aOptimizedEncoding),
         mConsumer(aConsumer),
         mConsumerAborted(false) {
     MOZ_DIAGNOSTIC_ASSERT(mWorkerStreamOwner);
     MOZ_DIAGNOSTIC_ASSERT(mConsumer);
+    MOZ_DIAGNOSTIC_ASSERT(!(mCache != nullptr && mOptimizedEncoding));
   }
 
   ~JSStreamConsumer() {
@@ -351,6 +414,18 @@ class JSStreamConsumer final : public nsIInputStreamCallback {
     JSStreamConsumer* self = reinterpret_cast<JSStreamConsumer*>(aClosure);
     MOZ_DIAGNOSTIC_ASSERT(!self->mConsumerAborted);
 
+    if (self->mOptimizedEncoding) {
+      if (!self->mOptimizedEncodingBytes.append(
+              reinterpret_cast<const uint8_t*>(aFromSegment), aCount)) {
+        self->mConsumer->streamError(size_t(NS_ERROR_OUT_OF_MEMORY));
+        self->mConsumerAborted = true;
+        return NS_ERROR_OUT_OF_MEMORY;
+      }
+
+      *aWriteCount = aCount;
+      return NS_OK;
+    }
+
     // This callback can be called on any thread which is explicitly allowed by
     // this particular JS API call.
     if (!self->mConsumer->consumeChunk((const uint8_t*)aFromSegment, aCount)) {
@@ -367,7 +442,9 @@ class JSStreamConsumer final : public nsIInputStreamCallback {
 
   static bool Start(nsCOMPtr<nsIInputStream>&& aStream,
                     JS::StreamConsumer* aConsumer, nsIGlobalObject* aGlobal,
-                    WorkerPrivate* aMaybeWorker) {
+                    WorkerPrivate* aMaybeWorker,
+                    const nsMainThreadPtrHandle<nsICacheInfoChannel>& aCache,
+                    bool aOptimizedEncoding) {
     nsCOMPtr<nsIAsyncInputStream> asyncStream;
     nsresult rv = NS_MakeAsyncNonBlockingInputStream(
         aStream.forget(), getter_AddRefs(asyncStream));
@@ -383,7 +460,8 @@ class JSStreamConsumer final : public nsIInputStreamCallback {
         return false;
       }
 
-      consumer = new JSStreamConsumer(std::move(owner), aGlobal, aConsumer);
+      consumer = new JSStreamConsumer(std::move(owner), aGlobal, aConsumer,
+                                      aCache, aOptimizedEncoding);
     } else {
       RefPtr<WindowStreamOwner> owner =
           WindowStreamOwner::Create(asyncStream, aGlobal);
@@ -391,7 +469,8 @@ class JSStreamConsumer final : public nsIInputStreamCallback {
         return false;
       }
 
-      consumer = new JSStreamConsumer(owner.forget(), aGlobal, aConsumer);
+      consumer = new JSStreamConsumer(owner.forget(), aGlobal, aConsumer,
+                                      aCache, aOptimizedEncoding);
     }
 
     // This AsyncWait() creates a ref-cycle between asyncStream and consumer:
@@ -420,7 +499,14 @@ class JSStreamConsumer final : public nsIInputStreamCallback {
     }
 
     if (rv == NS_BASE_STREAM_CLOSED) {
-      mConsumer->streamEnd();
+      if (mOptimizedEncoding) {
+        mConsumer->consumeOptimizedEncoding(mOptimizedEncodingBytes.begin(),
+                                            mOptimizedEncodingBytes.length());
+      } else {
+        // If there is a cache entry, pass 'this' as the listener so that the
+        // compiled code can be stored once it's available.
+        mConsumer->streamEnd(mCache != nullptr ? this : nullptr);
+      }
       return NS_OK;
     }
 
@@ -449,10 +535,98 @@ class JSStreamConsumer final : public nsIInputStreamCallback {
 
     return NS_OK;
   }
+
+  // JS::OptimizedEncodingListener:
+
+  void storeOptimizedEncoding(
+      JS::UniqueOptimizedEncodingBytes aBytes) override {
+    // Called on a helper thread once the optimized tier has been compiled.
+    // The cache entry can only be written to from the main thread.
+    MOZ_ASSERT(mCache != nullptr, "we only listen if there's a cache entry");
+
+    nsMainThreadPtrHandle<nsICacheInfoChannel> cache = mCache;
+    nsCOMPtr<nsIRunnable> store = NS_NewRunnableFunction(
+        "JSStreamConsumer::storeOptimizedEncoding",
+        [cache, bytes = std::move(aBytes)]() {
+          StoreWasmAltData(cache, *bytes);
+        });
+    NS_DispatchToMainThread(store.forget());
+  }
 };
 
 NS_IMPL_ISUPPORTS(JSStreamConsumer, nsIInputStreamCallback)
 
+// Waits for the alternative data stream of a wasm response and then starts
+// consuming either it or, if it couldn't be opened, the original body.
+class WasmAltDataReceiver final : public nsIInputStreamReceiver {
+  nsCOMPtr<nsIInputStream> mBody;
+  JS::StreamConsumer* mConsumer;
+  nsCOMPtr<nsIGlobalObject> mGlobal;
+  nsMainThreadPtrHandle<nsICacheInfoChannel> mCache;
+
+  ~WasmAltDataReceiver() = default;
+
+ public:
+  NS_DECL_ISUPPORTS
+
+  WasmAltDataReceiver(nsCOMPtr<nsIInputStream>&& aBody,
+                      JS::StreamConsumer* aConsumer, nsIGlobalObject* aGlobal,
+                      const nsMainThreadPtrHandle<nsICacheInfoChannel>& aCache)
+      : mBody(std::move(aBody)),
+        mConsumer(aConsumer),
+        mGlobal(aGlobal),
+        mCache(aCache) {
+    MOZ_ASSERT(NS_IsMainThread());
+  }
+
+  // nsIInputStreamReceiver:
+
+  NS_IMETHOD
+  OnInputStreamReady(nsIInputStream* aStream) override {
+    MOZ_ASSERT(NS_IsMainThread());
+
+    bool started;
+    if (aStream) {
+      nsCOMPtr<nsIInputStream> altBody = aStream;
+      started = JSStreamConsumer::Start(std::move(altBody), mConsumer, mGlobal,
+                                        nullptr, nullptr,
+                                        /* aOptimizedEncoding */ true);
+    } else {
+      started = JSStreamConsumer::Start(std::move(mBody), mConsumer, mGlobal,
+                                        nullptr, mCache,
+                                        /* aOptimizedEncoding */ false);
+    }
+
+    if (!started) {
+      mConsumer->streamError(size_t(NS_ERROR_OUT_OF_MEMORY));
+    }
+    return NS_OK;
+  }
+};
+
+NS_IMPL_ISUPPORTS(WasmAltDataReceiver, nsIInputStreamReceiver)
+
+static StaticAutoPtr<nsCString> sWasmAltDataType;
+
+// static
+const nsCString& FetchUtil::WasmAltDataType() {
+  MOZ_ASSERT(NS_IsMainThread());
+
+  if (!sWasmAltDataType) {
+    sWasmAltDataType = new nsCString();
+    ClearOnShutdown(&sWasmAltDataType);
+
+    JS::BuildIdCharVector buildId;
+    if (JS::GetOptimizedEncodingBuildId(&buildId)) {
+      sWasmAltDataType->AssignLiteral(WASM_ALT_DATA_TYPE_V1);
+      sWasmAltDataType->Append('-');
+      sWasmAltDataType->Append(buildId.begin(), buildId.length());
+    }
+  }
+
+  return *sWasmAltDataType;
+}
+
 static bool ThrowException(JSContext* aCx, unsigned errorNumber) {
   JS_ReportErrorNumberASCII(aCx, js::GetErrorMessage, nullptr, errorNumber);
   return false;
@@ -538,8 +712,35 @@ bool FetchUtil::StreamResponseToJS(JSContext* aCx, JS::HandleObject aObj,
 
   nsIGlobalObject* global = xpc::NativeGlobal(js::UncheckedUnwrap(aObj));
 
+  // The cache entry of the response can only be used on the main thread.
+  nsMainThreadPtrHandle<nsICacheInfoChannel> cache;
+  if (!aMaybeWorker && ir->HasCacheInfoChannel()) {
+    cache = ir->TakeCacheInfoChannel();
+
+    // If compiled code was stored by an earlier load of the same cache entry,
+    // hand that to the consumer instead of recompiling the bytecode.
+    nsAutoCString altDataType;
+    const nsCString& wasmAltDataType = FetchUtil::WasmAltDataType();
+    if (!wasmAltDataType.IsEmpty() &&
+        NS_SUCCEEDED(cache->GetAlternativeDataType(altDataType)) &&
+        altDataType.Equals(wasmAltDataType)) {
+      RefPtr<WasmAltDataReceiver> receiver =
+          new WasmAltDataReceiver(std::move(body), aConsumer, global, cache);
+      if (NS_SUCCEEDED(cache->GetAltDataInputStream(wasmAltDataType,
+                                                    receiver))) {
+        return true;
+      }
+
+      // GetAltDataInputStream() failed without calling the receiver; take the
+      // body back and stream it as usual.
+      receiver->OnInputStreamReady(nullptr);
+      return true;
+    }
+  }
+
   if (!JSStreamConsumer::Start(std::move(body), aConsumer, global,
-                               aMaybeWorker)) {
+                               aMaybeWorker, cache,
+                               /* aOptimizedEncoding */ false)) {
     return ThrowException(aCx, JSMSG_OUT_OF_MEMORY);
   }
 
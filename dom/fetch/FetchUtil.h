@@ -71,6 +71,16 @@ class FetchUtil final {
    * untyped 'size_t' instead of Gecko 'nsresult'.
    */
   static void ReportJSStreamError(JSContext* aCx, size_t aErrorCode);
+
+  /**
+   * The alternative data type under which compiled wasm machine code is stored
+   * next to a wasm response in the HTTP cache. It embeds the JS engine's
+   * optimized encoding build id, which covers both the build and the CPU
+   * features, so an entry written by another build or on another CPU is never
+   * handed back to the JS engine. Main thread only; returns an empty string if
+   * the build id is unavailable, in which case wasm caching is disabled.
+   */
+  static const nsCString& WasmAltDataType();
 };
 
 }  // namespace dom
@@ -14,12 +14,21 @@
 #include "ProcessPriorityManager.h"
 #include "nsServiceManagerUtils.h"
 #include "nsIXULRuntime.h"
+#include "prsystem.h"
+
+#include <algorithm>
 
 // This number is fairly arbitrary ... the intention is to put off
 // launching another app process until the last one has finished
 // loading its content, to reduce CPU/memory/IO contention.
 #define DEFAULT_ALLOCATE_DELAY 1000
 
+// How many preallocated processes to keep around by default. Each idle
+// content process costs tens of megabytes, so on top of the pref we keep at
+// most one per BYTES_PER_PREALLOCATED_PROCESS of physical memory.
+#define DEFAULT_POOL_SIZE 1
+#define BYTES_PER_PREALLOCATED_PROCESS (uint64_t(1) << 30)
+
 using namespace mozilla::hal;
 using namespace mozilla::dom;
 
@@ -44,6 +53,8 @@ class PreallocatedProcessManagerImpl final : public nsIObserver {
  private:
   static mozilla::StaticRefPtr<PreallocatedProcessManagerImpl> sSingleton;
   static uint32_t sPrelaunchDelayMS;
+  static uint32_t sPoolSize;
+  static uint32_t sMemoryPoolLimit;
 
   PreallocatedProcessManagerImpl();
   ~PreallocatedProcessManagerImpl();
@@ -51,6 +62,7 @@ class PreallocatedProcessManagerImpl final : public nsIObserver {
 
   void Init();
 
+  uint32_t MaxPoolSize() const;
   bool CanAllocate();
   void AllocateAfterDelay();
   void AllocateOnIdle();
@@ -66,10 +78,14 @@ class PreallocatedProcessManagerImpl final : public nsIObserver {
   bool mEnabled;
   bool mShutdown;
   bool mLaunchInProgress;
-  RefPtr<ContentParent> mPreallocatedProcess;
+  nsTArray<RefPtr<ContentParent>> mPreallocatedProcesses;
   nsTHashtable<nsUint64HashKey> mBlockers;
 
-  bool IsEmpty() const { return !mPreallocatedProcess && !mLaunchInProgress; }
+  // True if there is no launch in progress and the pool isn't full yet.
+  bool HasRoom() const {
+    return !mLaunchInProgress &&
+           mPreallocatedProcesses.Length() < MaxPoolSize();
+  }
 };
 
 /* static */
@@ -77,6 +93,10 @@ StaticRefPtr<PreallocatedProcessManagerImpl>
     PreallocatedProcessManagerImpl::sSingleton;
 /* static */
 uint32_t PreallocatedProcessManagerImpl::sPrelaunchDelayMS = 0;
+/* static */
+uint32_t PreallocatedProcessManagerImpl::sPoolSize = DEFAULT_POOL_SIZE;
+/* static */
+uint32_t PreallocatedProcessManagerImpl::sMemoryPoolLimit = 1;
 
 /* static */
 PreallocatedProcessManagerImpl* PreallocatedProcessManagerImpl::Singleton() {
@@ -105,6 +125,13 @@ void PreallocatedProcessManagerImpl::Init() {
   Preferences::AddUintVarCache(&sPrelaunchDelayMS,
                                "dom.ipc.processPrelaunch.delayMs",
                                DEFAULT_ALLOCATE_DELAY);
+  Preferences::AddUintVarCache(&sPoolSize, "dom.ipc.processPrelaunch.poolSize",
+                               DEFAULT_POOL_SIZE);
+  uint64_t bytes = PR_GetPhysicalMemorySize();
+  if (bytes) {
+    sMemoryPoolLimit = uint32_t(
+        std::min<uint64_t>(bytes / BYTES_PER_PREALLOCATED_PROCESS, UINT32_MAX));
+  }
   Preferences::AddStrongObserver(this, "dom.ipc.processPrelaunch.enabled");
   // We have to respect processCount at all time. This is especially important
   // for testing.
@@ -141,9 +168,9 @@ PreallocatedProcessManagerImpl::Observe(nsISupports* aSubject,
       os->RemoveObserver(this, "profile-change-teardown");
     }
     // Let's prevent any new preallocated processes from starting. ContentParent
-    // will handle the shutdown of the existing process and the
-    // mPreallocatedProcess reference will be cleared by the ClearOnShutdown of
-    // the manager singleton.
+    // will handle the shutdown of the existing processes and the
+    // mPreallocatedProcesses references will be cleared by the ClearOnShutdown
+    // of the manager singleton.
     mShutdown = true;
   } else {
     MOZ_ASSERT(false);
@@ -171,28 +198,40 @@ already_AddRefed<ContentParent> PreallocatedProcessManagerImpl::Take() {
     return nullptr;
   }
 
-  if (mPreallocatedProcess) {
-    // The preallocated process is taken. Let's try to start up a new one soon.
-    ProcessPriorityManager::SetProcessPriority(mPreallocatedProcess,
-                                               PROCESS_PRIORITY_FOREGROUND);
-    AllocateOnIdle();
+  if (mPreallocatedProcesses.IsEmpty()) {
+    return nullptr;
   }
 
-  return mPreallocatedProcess.forget();
+  // Hand out the oldest process, which is the most likely to have finished
+  // starting up. Let's try to start up a replacement soon.
+  RefPtr<ContentParent> process = mPreallocatedProcesses[0].forget();
+  mPreallocatedProcesses.RemoveElementAt(0);
+  ProcessPriorityManager::SetProcessPriority(process,
+                                             PROCESS_PRIORITY_FOREGROUND);
+  AllocateOnIdle();
+
+  return process.forget();
 }
 
 bool PreallocatedProcessManagerImpl::Provide(ContentParent* aParent) {
-  // This will take the already-running process even if there's a
-  // launch in progress; if that process hasn't been taken by the
-  // time the launch completes, the new process will be shut down.
-  if (mEnabled && !mShutdown && !mPreallocatedProcess) {
-    mPreallocatedProcess = aParent;
-  }
-
   // We might get a call from both NotifyTabDestroying and NotifyTabDestroyed
   // with the same ContentParent. Returning true here for both calls is
   // important to avoid the cached process to be destroyed.
-  return aParent == mPreallocatedProcess;
+  if (mPreallocatedProcesses.Contains(aParent)) {
+    return true;
+  }
+
+  // This will take the already-running process even if there's a launch in
+  // progress; if the pool is full by the time the launch completes, the new
+  // process will be shut down. The recycled process has finished starting up
+  // and TryToRecycle only offers young ones, so put it first for Take().
+  if (mEnabled && !mShutdown &&
+      mPreallocatedProcesses.Length() < MaxPoolSize()) {
+    mPreallocatedProcesses.InsertElementAt(0, aParent);
+    return true;
+  }
+
+  return false;
 }
 
 void PreallocatedProcessManagerImpl::Enable() {
@@ -220,15 +259,23 @@ void PreallocatedProcessManagerImpl::RemoveBlocker(ContentParent* aParent) {
   // it's possible for a short-lived process to be recycled through
   // Provide() and Take() before reaching RecvFirstIdle.)
   mBlockers.RemoveEntry(childID);
-  if (IsEmpty() && mBlockers.IsEmpty()) {
+  if (HasRoom() && mBlockers.IsEmpty()) {
     AllocateAfterDelay();
   }
 }
 
+uint32_t PreallocatedProcessManagerImpl::MaxPoolSize() const {
+  return std::max(1u, std::min(sPoolSize, sMemoryPoolLimit));
+}
+
 bool PreallocatedProcessManagerImpl::CanAllocate() {
-  return mEnabled && mBlockers.IsEmpty() && IsEmpty() && !mShutdown &&
-         !ContentParent::IsMaxProcessCountReached(
-             NS_LITERAL_STRING(DEFAULT_REMOTE_TYPE));
+  // Preallocated processes aren't in ContentParent's pool until they are
+  // taken, so count them against processCount here.
+  return mEnabled && mBlockers.IsEmpty() && HasRoom() && !mShutdown &&
+         ContentParent::GetPoolSize(NS_LITERAL_STRING(DEFAULT_REMOTE_TYPE)) +
+                 mPreallocatedProcesses.Length() <
+             ContentParent::GetMaxProcessCount(
+                 NS_LITERAL_STRING(DEFAULT_REMOTE_TYPE));
 }
 
 void PreallocatedProcessManagerImpl::AllocateAfterDelay() {
@@ -255,7 +302,7 @@ void PreallocatedProcessManagerImpl::AllocateOnIdle() {
 
 void PreallocatedProcessManagerImpl::AllocateNow() {
   if (!CanAllocate()) {
-    if (mEnabled && !mShutdown && IsEmpty() && !mBlockers.IsEmpty()) {
+    if (mEnabled && !mShutdown && HasRoom() && !mBlockers.IsEmpty()) {
       // If it's too early to allocate a process let's retry later.
       AllocateAfterDelay();
     }
@@ -271,7 +318,9 @@ void PreallocatedProcessManagerImpl::AllocateNow() {
       [self, this](const RefPtr<ContentParent>& process) {
         mLaunchInProgress = false;
         if (CanAllocate()) {
-          mPreallocatedProcess = process;
+          mPreallocatedProcesses.AppendElement(process);
+          // Keep filling the pool, one launch at a time.
+          AllocateOnIdle();
         } else {
           process->ShutDownProcess(ContentParent::SEND_SHUTDOWN_MESSAGE);
         }
@@ -292,9 +341,10 @@ void PreallocatedProcessManagerImpl::Disable() {
 }
 
 void PreallocatedProcessManagerImpl::CloseProcess() {
-  if (mPreallocatedProcess) {
-    mPreallocatedProcess->ShutDownProcess(ContentParent::SEND_SHUTDOWN_MESSAGE);
-    mPreallocatedProcess = nullptr;
+  nsTArray<RefPtr<ContentParent>> processes;
+  processes.SwapElements(mPreallocatedProcesses);
+  for (auto& process : processes) {
+    process->ShutDownProcess(ContentParent::SEND_SHUTDOWN_MESSAGE);
   }
 }
 
@@ -307,8 +357,11 @@ void PreallocatedProcessManagerImpl::ObserveProcessShutdown(
   props->GetPropertyAsUint64(NS_LITERAL_STRING("childID"), &childID);
   NS_ENSURE_TRUE_VOID(childID != CONTENT_PROCESS_ID_UNKNOWN);
 
-  if (mPreallocatedProcess && childID == mPreallocatedProcess->ChildID()) {
-    mPreallocatedProcess = nullptr;
+  for (uint32_t i = 0; i < mPreallocatedProcesses.Length(); i++) {
+    if (mPreallocatedProcesses[i]->ChildID() == childID) {
+      mPreallocatedProcesses.RemoveElementAt(i);
+      break;
+    }
   }
 
   mBlockers.RemoveEntry(childID);
@@ -21,6 +21,9 @@ class ContentParent;
  * already started it up, it should be ready for use faster than if you'd
  * created the process when you needed it.
  *
+ * Up to dom.ipc.processPrelaunch.poolSize processes are kept around, limited
+ * further by the amount of physical memory, and Take() hands out the oldest.
+ *
  * This class watches the dom.ipc.processPrelaunch.enabled pref.  If it changes
  * from false to true, it preallocates a process.  If it changes from true to
  * false, it kills the preallocated process, if any.
@@ -44,8 +47,8 @@ class PreallocatedProcessManager final {
    * Take the preallocated process, if we have one.  If we don't have one, this
    * returns null.
    *
-   * If you call Take() twice in a row, the second call is guaranteed to return
-   * null.
+   * With the default pool size of one, if you call Take() twice in a row, the
+   * second call is guaranteed to return null.
    *
    * After you Take() the preallocated process, you need to call one of the
    * Allocate* functions (or change the dom.ipc.processPrelaunch pref from
@@ -53,6 +56,15 @@ class PreallocatedProcessManager final {
    */
   static already_AddRefed<ContentParent> Take();
 
+  /**
+   * Offer a live, unused content process (ContentParent::TryToRecycle) to the
+   * pool.  Returns true if the pool holds aParent, including when it was
+   * already provided; otherwise the caller keeps ownership and shuts it down.
+   *
+   * A provided process doesn't evict anything: it is refused when the pool is
+   * full, which with the default pool size of one is the old single-slot
+   * behaviour.  Accepted processes are handed out by the next Take().
+   */
   static bool Provide(ContentParent* aParent);
 
  private:
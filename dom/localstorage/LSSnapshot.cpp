@@ -6,6 +6,8 @@
 
 #include "LSSnapshot.h"
 
+#include "LocalStorageCommon.h"
+#include "mozilla/Logging.h"
 #include "nsContentUtils.h"
 
 namespace mozilla {
@@ -107,6 +109,7 @@ LSSnapshot::LSSnapshot(LSDatabase* aDatabase)
       mLength(0),
       mExactUsage(0),
       mPeakUsage(0),
+      mSyncMessageCount(0),
       mLoadState(LoadState::Initial),
       mHasOtherProcessObservers(false),
       mExplicit(false),
@@ -558,6 +561,7 @@ nsresult LSSnapshot::GetItemInternal(const nsAString& aKey,
       } else {
         LSValue value;
         nsTArray<LSItemInfo> itemInfos;
+        ++mSyncMessageCount;
         if (NS_WARN_IF(!mActor->SendLoadValueAndMoreItems(
                 nsString(aKey), &value, &itemInfos))) {
           return NS_ERROR_FAILURE;
@@ -606,6 +610,7 @@ nsresult LSSnapshot::GetItemInternal(const nsAString& aKey,
         if (result.IsVoid()) {
           LSValue value;
           nsTArray<LSItemInfo> itemInfos;
+          ++mSyncMessageCount;
           if (NS_WARN_IF(!mActor->SendLoadValueAndMoreItems(
                   nsString(aKey), &value, &itemInfos))) {
             return NS_ERROR_FAILURE;
@@ -703,6 +708,7 @@ nsresult LSSnapshot::EnsureAllKeys() {
   }
 
   nsTArray<nsString> keys;
+  ++mSyncMessageCount;
   if (NS_WARN_IF(!mActor->SendLoadKeys(&keys))) {
     return NS_ERROR_FAILURE;
   }
@@ -816,6 +822,7 @@ nsresult LSSnapshot::UpdateUsage(int64_t aDelta) {
     int64_t minSize = newExactUsage - mPeakUsage;
     int64_t requestedSize = minSize + 4096;
     int64_t size;
+    ++mSyncMessageCount;
     if (NS_WARN_IF(
             !mActor->SendIncreasePeakUsage(requestedSize, minSize, &size))) {
       return NS_ERROR_FAILURE;
@@ -875,6 +882,10 @@ nsresult LSSnapshot::Finish() {
 
   MOZ_ALWAYS_TRUE(mActor->SendFinish());
 
+  MOZ_LOG(GetLocalStorageLogger(), LogLevel::Debug,
+          ("LSSnapshot [%p] finished, %u sync message(s) after prefill", this,
+           mSyncMessageCount));
+
   mDatabase->NoteFinishedSnapshot(this);
 
 #ifdef DEBUG
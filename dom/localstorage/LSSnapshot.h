@@ -88,6 +88,10 @@ class LSSnapshot final : public nsIRunnable {
   int64_t mExactUsage;
   int64_t mPeakUsage;
 
+  // The number of synchronous round trips this snapshot needed after Init,
+  // because the prefill or the initial usage reservation fell short.
+  uint32_t mSyncMessageCount;
+
   LoadState mLoadState;
 
   bool mHasOtherProcessObservers;
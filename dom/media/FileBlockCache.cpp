@@ -438,6 +438,19 @@ nsresult FileBlockCache::Read(int64_t aOffset, uint8_t* aData, int32_t aLength,
       // Block has been written to file, either as the source block of a move,
       // or as a stable (all changes made) block. Read the data directly
       // from file.
+      // If this block is stable on file, coalesce any following stable
+      // blocks into the same read, so that long sequential reads don't cost
+      // a seek and a read call per block.
+      int32_t readLength = amount;
+      if (!change) {
+        int32_t nextBlockIndex = blockIndex + 1;
+        while (readLength < bytesToRead &&
+               static_cast<uint32_t>(nextBlockIndex) < mBlockChanges.Length() &&
+               !mBlockChanges[nextBlockIndex]) {
+          readLength += std::min(BLOCK_SIZE, bytesToRead - readLength);
+          nextBlockIndex++;
+        }
+      }
       nsresult res;
       {
         MutexAutoUnlock unlock(mDataMutex);
@@ -446,8 +459,8 @@ nsresult FileBlockCache::Read(int64_t aOffset, uint8_t* aData, int32_t aLength,
           // Not initialized yet, or closed.
           return NS_ERROR_FAILURE;
         }
-        res = ReadFromFile(BlockIndexToOffset(blockIndex) + start, dst, amount,
-                           bytesRead);
+        res = ReadFromFile(BlockIndexToOffset(blockIndex) + start, dst,
+                           readLength, bytesRead);
       }
       NS_ENSURE_SUCCESS(res, res);
     }
@@ -490,6 +490,7 @@ AudioCallbackDriver::AudioCallbackDriver(MediaStreamGraphImpl* aGraphImpl,
       mSampleRate(0),
       mInputChannelCount(aInputChannelCount),
       mIterationDurationMS(MEDIA_GRAPH_TARGET_PERIOD_MS),
+      mMeasuredLoad(0.0f),
       mStarted(false),
       mInitShutdownThread(
           SharedThreadPool::Get(NS_LITERAL_CSTRING("CubebOperation"), 1)),
@@ -913,7 +914,22 @@ long AudioCallbackDriver::DataCallback(const AudioDataValue* aInputBuffer,
   if (mBuffer.Available()) {
     // We totally filled the buffer (and mScratchBuffer isn't empty).
     // We don't need to run an iteration and if we do so we may overflow.
+    TimeStamp iterationStart = TimeStamp::Now();
     stillProcessing = GraphImpl()->OneIteration(nextStateComputedTime);
+    // Compare the time it took to run the graph against the real-time
+    // duration of the buffer we were asked to fill.
+    float load = (TimeStamp::Now() - iterationStart).ToSeconds() *
+                 mSampleRate / aFrames;
+    mMeasuredLoad = (mMeasuredLoad * 3 + load) / 4;
+    LOG(LogLevel::Verbose,
+        ("%p: Iteration load %.2f (smoothed %.2f)", GraphImpl(), load,
+         mMeasuredLoad));
+    if (load >= 1.0f) {
+      LOG(LogLevel::Warning,
+          ("%p: Iteration took longer than the audio callback budget "
+           "(load %.2f)",
+           GraphImpl(), load));
+    }
   } else {
     LOG(LogLevel::Verbose,
         ("%p: DataCallback buffer filled entirely from scratch "
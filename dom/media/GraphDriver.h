@@ -389,6 +389,11 @@ class AudioCallbackDriver : public GraphDriver,
   /* This is an approximation of the number of millisecond there are between two
    * iterations of the graph. */
   uint32_t IterationDuration() override;
+  /* The fraction of the audio callback's real-time budget spent running the
+   * graph, smoothed over recent callbacks. A value at or above 1.0 means the
+   * graph can't keep up and output will glitch. Only accessed on the audio
+   * callback thread. */
+  float MeasuredLoad() const { return mMeasuredLoad; }
 
   /* This function gets called when the graph has produced the audio frames for
    * this iteration. */
@@ -486,6 +491,8 @@ class AudioCallbackDriver : public GraphDriver,
    * video frames. This is in milliseconds. Only even used (after
    * inizatialization) on the audio callback thread. */
   uint32_t mIterationDurationMS;
+  /* See MeasuredLoad(). */
+  float mMeasuredLoad;
   /* cubeb_stream_init calls the audio callback to prefill the buffers. The
    * previous driver has to be kept alive until the audio stream has been
    * started, because it is responsible to call cubeb_stream_start, so we delay
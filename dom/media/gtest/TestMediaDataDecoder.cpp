@@ -8,10 +8,16 @@
 #include "MockMediaResource.h"
 #include "DecoderTraits.h"
 #include "MediaContainerType.h"
+#include "MP3Decoder.h"
+#include "MP3Demuxer.h"
 #include "MP4Demuxer.h"
 #include "WebMDecoder.h"
 #include "WebMDemuxer.h"
+#include "PDMFactory.h"
+#include "VideoUtils.h"
 #include "mozilla/AbstractThread.h"
+#include "mozilla/TaskQueue.h"
+#include "mozilla/media/MediaUtils.h"
 #include "nsMimeTypes.h"
 
 using namespace mozilla;
@@ -74,3 +80,91 @@ TEST(MediaDataDecoder, VP9)
     EXPECT_GT(runner.Run(), 0u);
   }
 }
+
+TEST(MediaDataDecoder, MP3)
+{
+  if (!MP3Decoder::IsSupportedType(
+          MediaContainerType(MEDIAMIMETYPE(AUDIO_MP3)))) {
+    return;
+  }
+
+  RefPtr<MockMediaResource> resource = new MockMediaResource("noise.mp3");
+  nsresult rv = resource->Open();
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+
+  RefPtr<MP3TrackDemuxer> demuxer = new MP3TrackDemuxer(resource);
+  ASSERT_TRUE(demuxer->Init());
+  UniquePtr<TrackInfo> info = demuxer->GetInfo();
+  ASSERT_TRUE(info && info->GetAsAudioInfo());
+  const AudioInfo& audioInfo = *info->GetAsAudioInfo();
+  EXPECT_EQ(44100u, audioInfo.mRate);
+
+  nsTArray<RefPtr<MediaRawData>> samples;
+  while (RefPtr<MediaRawData> sample = demuxer->DemuxSample()) {
+    samples.AppendElement(std::move(sample));
+  }
+  ASSERT_FALSE(samples.IsEmpty());
+
+  Benchmark::Init();
+  RefPtr<TaskQueue> taskQueue =
+      new TaskQueue(GetMediaThreadPool(MediaThreadType::PLATFORM_DECODER));
+  RefPtr<PDMFactory> platform = new PDMFactory();
+  RefPtr<MediaDataDecoder> decoder =
+      platform->CreateDecoder({audioInfo, taskQueue});
+  ASSERT_TRUE(decoder);
+
+  bool succeeded = false;
+  media::Await(
+      GetMediaThreadPool(MediaThreadType::PLAYBACK), decoder->Init(),
+      [&succeeded](TrackInfo::TrackType aType) {
+        EXPECT_EQ(TrackInfo::kAudioTrack, aType);
+        succeeded = true;
+      },
+      [&succeeded](const MediaResult& aError) { succeeded = false; });
+  ASSERT_TRUE(succeeded);
+
+  MediaDataDecoder::DecodedData output;
+  auto append = [&output, &succeeded](MediaDataDecoder::DecodedData&& aData) {
+    output.AppendElements(std::move(aData));
+    succeeded = true;
+  };
+  auto fail = [&succeeded](const MediaResult& aError) { succeeded = false; };
+  for (MediaRawData* sample : samples) {
+    media::Await(GetMediaThreadPool(MediaThreadType::PLAYBACK),
+                 decoder->Decode(sample), append, fail);
+    ASSERT_TRUE(succeeded);
+  }
+  // Drain until the decoder has nothing left to return.
+  size_t decoded;
+  do {
+    decoded = output.Length();
+    media::Await(GetMediaThreadPool(MediaThreadType::PLAYBACK),
+                 decoder->Drain(), append, fail);
+    ASSERT_TRUE(succeeded);
+  } while (output.Length() != decoded);
+
+  ASSERT_FALSE(output.IsEmpty());
+  uint64_t frames = 0;
+  for (MediaData* data : output) {
+    ASSERT_EQ(MediaData::Type::AUDIO_DATA, data->mType);
+    AudioData* audio = data->As<AudioData>();
+    EXPECT_EQ(audioInfo.mChannels, audio->mChannels);
+    EXPECT_EQ(audioInfo.mRate, audio->mRate);
+    frames += audio->Frames();
+  }
+  // Every MPEG-1 layer III frame decodes to 1152 samples per channel; allow
+  // for decoders that drop the encoder delay or the padding at the end.
+  EXPECT_GT(frames, (samples.Length() - 2) * 1152);
+  EXPECT_LE(frames, samples.Length() * 1152);
+
+  // media::Await() supports exclusive promises only, but ShutdownPromise is
+  // not.
+  bool shutdown = false;
+  decoder->Shutdown()->Then(
+      AbstractThread::MainThread(), __func__,
+      [&shutdown](bool) { shutdown = true; },
+      [&shutdown]() { shutdown = true; });
+  SpinEventLoopUntil([&shutdown]() { return shutdown; });
+  taskQueue->BeginShutdown();
+  taskQueue->AwaitShutdownAndIdle();
+}
@@ -16,6 +16,9 @@
 #  include "AlignmentUtils.h"
 #  include "AudioNodeEngineSSE2.h"
 #endif
+#ifdef USE_AVX2
+#  include "AudioNodeEngineAVX2.h"
+#endif
 #include "AudioBlock.h"
 
 namespace mozilla {
@@ -90,7 +93,14 @@ void AudioBufferAddWithScale(const float* aInput, float aScale, float* aOutput,
     // we need to round aSize down to the nearest multiple of 16
     uint32_t alignedSize = aSize & ~0x0F;
     if (alignedSize > 0) {
-      AudioBufferAddWithScale_SSE(aInput, aScale, aOutput, alignedSize);
+#  ifdef USE_AVX2
+      if (mozilla::supports_avx2()) {
+        AudioBufferAddWithScale_AVX2(aInput, aScale, aOutput, alignedSize);
+      } else
+#  endif
+      {
+        AudioBufferAddWithScale_SSE(aInput, aScale, aOutput, alignedSize);
+      }
 
       // adjust parameters for use with scalar operations below
       aInput += alignedSize;
@@ -129,6 +139,13 @@ void AudioBlockCopyChannelWithScale(const float* aInput, float aScale,
     }
 #endif
 
+#ifdef USE_AVX2
+    if (mozilla::supports_avx2()) {
+      AudioBlockCopyChannelWithScale_AVX2(aInput, aScale, aOutput);
+      return;
+    }
+#endif
+
 #ifdef USE_SSE2
     if (mozilla::supports_sse2()) {
       AudioBlockCopyChannelWithScale_SSE(aInput, aScale, aOutput);
@@ -144,6 +161,13 @@ void AudioBlockCopyChannelWithScale(const float* aInput, float aScale,
 
 void BufferComplexMultiply(const float* aInput, const float* aScale,
                            float* aOutput, uint32_t aSize) {
+#ifdef USE_AVX2
+  if (mozilla::supports_avx2()) {
+    BufferComplexMultiply_AVX2(aInput, aScale, aOutput, aSize);
+    return;
+  }
+#endif
+
 #ifdef USE_SSE2
   if (mozilla::supports_sse()) {
     BufferComplexMultiply_SSE(aInput, aScale, aOutput, aSize);
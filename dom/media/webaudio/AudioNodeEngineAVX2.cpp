@@ -0,0 +1,79 @@
+/* -*- mode: c++; tab-width: 2; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* this source code form is subject to the terms of the mozilla public
+ * license, v. 2.0. if a copy of the mpl was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "AudioNodeEngineAVX2.h"
+#include "AlignmentUtils.h"
+#include <immintrin.h>
+
+// Callers only guarantee the 16-byte alignment the SSE versions need, so
+// these use unaligned loads and stores throughout.
+
+namespace mozilla {
+void AudioBufferAddWithScale_AVX2(const float* aInput, float aScale,
+                                  float* aOutput, uint32_t aSize) {
+  __m256 vin0, vin1, vout0, vout1;
+
+  ASSERT_ALIGNED16(aInput);
+  ASSERT_ALIGNED16(aOutput);
+  ASSERT_MULTIPLE16(aSize);
+
+  __m256 vgain = _mm256_set1_ps(aScale);
+
+  for (unsigned i = 0; i < aSize; i += 16) {
+    vin0 = _mm256_mul_ps(_mm256_loadu_ps(&aInput[i]), vgain);
+    vin1 = _mm256_mul_ps(_mm256_loadu_ps(&aInput[i + 8]), vgain);
+
+    vout0 = _mm256_add_ps(_mm256_loadu_ps(&aOutput[i]), vin0);
+    vout1 = _mm256_add_ps(_mm256_loadu_ps(&aOutput[i + 8]), vin1);
+
+    _mm256_storeu_ps(&aOutput[i], vout0);
+    _mm256_storeu_ps(&aOutput[i + 8], vout1);
+  }
+}
+
+void AudioBlockCopyChannelWithScale_AVX2(const float* aInput, float aScale,
+                                         float* aOutput) {
+  ASSERT_ALIGNED16(aInput);
+  ASSERT_ALIGNED16(aOutput);
+
+  __m256 vgain = _mm256_set1_ps(aScale);
+
+  for (unsigned i = 0; i < WEBAUDIO_BLOCK_SIZE; i += 16) {
+    __m256 vout0 = _mm256_mul_ps(_mm256_loadu_ps(&aInput[i]), vgain);
+    __m256 vout1 = _mm256_mul_ps(_mm256_loadu_ps(&aInput[i + 8]), vgain);
+    _mm256_storeu_ps(&aOutput[i], vout0);
+    _mm256_storeu_ps(&aOutput[i + 8], vout1);
+  }
+}
+
+void BufferComplexMultiply_AVX2(const float* aInput, const float* aScale,
+                                float* aOutput, uint32_t aSize) {
+  ASSERT_ALIGNED16(aInput);
+  ASSERT_ALIGNED16(aScale);
+  ASSERT_ALIGNED16(aOutput);
+  ASSERT_MULTIPLE16(aSize);
+
+  // Rather than deinterleaving like the SSE version does, multiply each
+  // (re, im) pair of the input by the duplicated real and imaginary parts of
+  // the scale, and combine the two with addsub:
+  //   (ar * br - ai * bi, ai * br + ar * bi)
+  for (unsigned i = 0; i < aSize * 2; i += 16) {
+    __m256 a0 = _mm256_loadu_ps(&aInput[i]);
+    __m256 a1 = _mm256_loadu_ps(&aInput[i + 8]);
+    __m256 b0 = _mm256_loadu_ps(&aScale[i]);
+    __m256 b1 = _mm256_loadu_ps(&aScale[i + 8]);
+
+    __m256 real0 = _mm256_mul_ps(a0, _mm256_moveldup_ps(b0));
+    __m256 real1 = _mm256_mul_ps(a1, _mm256_moveldup_ps(b1));
+    __m256 imag0 = _mm256_mul_ps(_mm256_permute_ps(a0, _MM_SHUFFLE(2, 3, 0, 1)),
+                                 _mm256_movehdup_ps(b0));
+    __m256 imag1 = _mm256_mul_ps(_mm256_permute_ps(a1, _MM_SHUFFLE(2, 3, 0, 1)),
+                                 _mm256_movehdup_ps(b1));
+
+    _mm256_storeu_ps(&aOutput[i], _mm256_addsub_ps(real0, imag0));
+    _mm256_storeu_ps(&aOutput[i + 8], _mm256_addsub_ps(real1, imag1));
+  }
+}
+}  // namespace mozilla
@@ -134,7 +134,13 @@ void ScriptLoadRequest::MaybeCancelOffThreadScript() {
   // Follow the same conditions as ScriptLoader::AttemptAsyncScriptCompile
   if (IsModuleRequest()) {
     JS::CancelOffThreadModule(cx, mOffThreadToken);
-  } else if (IsSource()) {
+  } else if (IsBinASTSource()) {
+#ifdef JS_BUILD_BINAST
+    JS::CancelOffThreadBinASTDecode(cx, mOffThreadToken);
+#else
+    MOZ_CRASH("BinAST not supported");
+#endif
+  } else if (IsTextSource()) {
     JS::CancelOffThreadScript(cx, mOffThreadToken);
   } else {
     MOZ_ASSERT(IsBytecode());
@@ -2069,6 +2069,16 @@ nsresult ScriptLoader::AttemptAsyncScriptCompile(ScriptLoadRequest* aRequest,
     return rv;
   }
 
+  // Modules imported by another module are usually fetched in parallel and
+  // become available in bursts. Parsing them one after another on the main
+  // thread serializes the whole graph behind it, so hand them to the helper
+  // threads even if they are small, as long as there is more than one core to
+  // parse them on.
+  if (aRequest->IsModuleRequest() && !aRequest->IsTopLevel() &&
+      NumberOfProcessors() > 1) {
+    options.forceAsync = true;
+  }
+
   if (aRequest->IsTextSource()) {
     if (!JS::CanCompileOffThread(cx, options, aRequest->ScriptTextLength())) {
       return NS_OK;
@@ -16,6 +16,10 @@
 #include "DataSurfaceHelpers.h"
 #include "Tools.h"
 
+#ifdef USE_AVX2
+#  include "mozilla/SSE.h"
+#  include "BlurAVX2.h"
+#endif
 #ifdef USE_NEON
 #  include "mozilla/arm.h"
 #endif
@@ -647,6 +651,19 @@ void AlphaBoxBlur::Blur(uint8_t* aData) const {
         return;
       }
 
+#ifdef USE_AVX2
+      if (mozilla::supports_avx2()) {
+        BoxBlur_AVX2(aData, horizontalLobes[0][0], horizontalLobes[0][1],
+                     verticalLobes[0][0], verticalLobes[0][1], integralImage,
+                     integralImageStride);
+        BoxBlur_AVX2(aData, horizontalLobes[1][0], horizontalLobes[1][1],
+                     verticalLobes[1][0], verticalLobes[1][1], integralImage,
+                     integralImageStride);
+        BoxBlur_AVX2(aData, horizontalLobes[2][0], horizontalLobes[2][1],
+                     verticalLobes[2][0], verticalLobes[2][1], integralImage,
+                     integralImageStride);
+      } else
+#endif
 #ifdef USE_SSE2
       if (Factory::HasSSE2()) {
         BoxBlur_SSE2(aData, horizontalLobes[0][0], horizontalLobes[0][1],
@@ -864,6 +881,55 @@ void AlphaBoxBlur::BoxBlur_C(uint8_t* aData, int32_t aLeftLobe,
   }
 }
 
+#ifdef USE_AVX2
+/**
+ * AVX2 version of BoxBlur_SSE2. The integral image is built with the SSE2
+ * code, since each row is a serial prefix sum that doesn't get any wider with
+ * AVX2; the blur pass itself handles 32 pixels per iteration. It lives in
+ * BlurAVX2.cpp, which is kept free of any shared inline code.
+ */
+void AlphaBoxBlur::BoxBlur_AVX2(uint8_t* aData, int32_t aLeftLobe,
+                                int32_t aRightLobe, int32_t aTopLobe,
+                                int32_t aBottomLobe, uint32_t* aIntegralImage,
+                                size_t aIntegralImageStride) const {
+  IntSize size = GetSize();
+
+  MOZ_ASSERT(size.height > 0);
+
+  // Our 'left' or 'top' lobe will include the current pixel. i.e. when
+  // looking at an integral image the value of a pixel at 'x,y' is calculated
+  // using the value of the integral image values above/below that.
+  aLeftLobe++;
+  aTopLobe++;
+  int32_t boxSize = (aLeftLobe + aRightLobe) * (aTopLobe + aBottomLobe);
+
+  MOZ_ASSERT(boxSize > 0);
+
+  if (boxSize == 1) {
+    return;
+  }
+
+  uint32_t reciprocal = uint32_t((uint64_t(1) << 32) / boxSize);
+
+  uint32_t stride32bit = aIntegralImageStride / 4;
+  int32_t leftInflation = RoundUpToMultipleOf4(aLeftLobe).value();
+
+  GenerateIntegralImage_SSE2(leftInflation, aRightLobe, aTopLobe, aBottomLobe,
+                             aIntegralImage, aIntegralImageStride, aData,
+                             mStride, size);
+
+  // This points to the start of the rectangle within the IntegralImage that
+  // overlaps the surface being blurred.
+  uint32_t* innerIntegral =
+      aIntegralImage + (aTopLobe * stride32bit) + leftInflation;
+
+  BoxBlurFromIntegralImage_AVX2(
+      aData, mStride, size.width, size.height, innerIntegral, stride32bit,
+      aLeftLobe, aRightLobe, aTopLobe, aBottomLobe, reciprocal, mSkipRect.X(),
+      mSkipRect.XMost(), mSkipRect.Y(), mSkipRect.YMost());
+}
+#endif
+
 /**
  * Compute the box blur size (which we're calling the blur radius) from
  * the standard deviation.
@@ -135,6 +135,12 @@ class GFX2D_API AlphaBoxBlur final {
                     int32_t aTopLobe, int32_t aBottomLobe,
                     uint32_t* aIntegralImage,
                     size_t aIntegralImageStride) const;
+#ifdef USE_AVX2
+  void BoxBlur_AVX2(uint8_t* aData, int32_t aLeftLobe, int32_t aRightLobe,
+                    int32_t aTopLobe, int32_t aBottomLobe,
+                    uint32_t* aIntegralImage,
+                    size_t aIntegralImageStride) const;
+#endif
   void BoxBlur_NEON(uint8_t* aData, int32_t aLeftLobe, int32_t aRightLobe,
                     int32_t aTopLobe, int32_t aBottomLobe,
                     uint32_t* aIntegralImage,
@@ -147,6 +153,19 @@ class GFX2D_API AlphaBoxBlur final {
 
   static CheckedInt<int32_t> RoundUpToMultipleOf4(int32_t aVal);
 
+#ifdef USE_SSE2
+  /**
+   * Fills aIntegralImage with the integral image of aSource, inflated by the
+   * given amounts. aLeftInflation must be a multiple of 4. Shared by the SSE2
+   * and AVX2 box blurs.
+   */
+  static void GenerateIntegralImage_SSE2(
+      int32_t aLeftInflation, int32_t aRightInflation, int32_t aTopInflation,
+      int32_t aBottomInflation, uint32_t* aIntegralImage,
+      size_t aIntegralImageStride, uint8_t* aSource, int32_t aSourceStride,
+      const IntSize& aSize);
+#endif
+
   /**
    * A rect indicating the area where blurring is unnecessary, and the blur
    * algorithm should skip over it.
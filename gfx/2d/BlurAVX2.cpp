@@ -0,0 +1,159 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "BlurAVX2.h"
+
+#include "mozilla/Attributes.h"
+
+#include <immintrin.h>
+
+namespace mozilla {
+namespace gfx {
+
+// These mirror Divide and BlurFourPixels in BlurSSE2.cpp, but operate on
+// eight pixels at a time. _mm256_mul_epu32 works on the even 32-bit lanes
+// just like its SSE2 counterpart, so the rounding trick carries over as is.
+static MOZ_ALWAYS_INLINE __m256i Divide_AVX2(__m256i aValues,
+                                             __m256i aDivisor) {
+  const __m256i mask = _mm256_setr_epi32(0x0, 0xffffffff, 0x0, 0xffffffff, 0x0,
+                                         0xffffffff, 0x0, 0xffffffff);
+  const __m256i roundingAddition = _mm256_set1_epi64x(int64_t(1) << 31);
+
+  __m256i multiplied31 = _mm256_mul_epu32(aValues, aDivisor);
+  __m256i multiplied42 =
+      _mm256_mul_epu32(_mm256_srli_epi64(aValues, 32), aDivisor);
+
+  // Add 1 << 31 before shifting or masking the lower 32 bits away, so that the
+  // result is rounded.
+  __m256i p_3_1 =
+      _mm256_srli_epi64(_mm256_add_epi64(multiplied31, roundingAddition), 32);
+  __m256i p4_2_ =
+      _mm256_and_si256(_mm256_add_epi64(multiplied42, roundingAddition), mask);
+  return _mm256_or_si256(p_3_1, p4_2_);
+}
+
+static MOZ_ALWAYS_INLINE __m256i BlurEightPixels(const uint32_t* aTopLeft,
+                                                 const uint32_t* aTopRight,
+                                                 const uint32_t* aBottomRight,
+                                                 const uint32_t* aBottomLeft,
+                                                 __m256i aDivisor) {
+  __m256i topLeft = _mm256_loadu_si256((const __m256i*)aTopLeft);
+  __m256i topRight = _mm256_loadu_si256((const __m256i*)aTopRight);
+  __m256i bottomRight = _mm256_loadu_si256((const __m256i*)aBottomRight);
+  __m256i bottomLeft = _mm256_loadu_si256((const __m256i*)aBottomLeft);
+  __m256i values = _mm256_add_epi32(
+      _mm256_sub_epi32(_mm256_sub_epi32(bottomRight, topRight), bottomLeft),
+      topLeft);
+  return Divide_AVX2(values, aDivisor);
+}
+
+static MOZ_ALWAYS_INLINE __m128i Divide_128(__m128i aValues,
+                                            __m128i aDivisor) {
+  const __m128i mask = _mm_setr_epi32(0x0, 0xffffffff, 0x0, 0xffffffff);
+  const __m128i roundingAddition = _mm_set1_epi64x(int64_t(1) << 31);
+
+  __m128i multiplied31 = _mm_mul_epu32(aValues, aDivisor);
+  __m128i multiplied42 = _mm_mul_epu32(_mm_srli_epi64(aValues, 32), aDivisor);
+
+  __m128i p_3_1 =
+      _mm_srli_epi64(_mm_add_epi64(multiplied31, roundingAddition), 32);
+  __m128i p4_2_ =
+      _mm_and_si128(_mm_add_epi64(multiplied42, roundingAddition), mask);
+  return _mm_or_si128(p_3_1, p4_2_);
+}
+
+void BoxBlurFromIntegralImage_AVX2(uint8_t* aData, int32_t aStride,
+                                   int32_t aWidth, int32_t aHeight,
+                                   const uint32_t* aInnerIntegral,
+                                   size_t aStride32bit, int32_t aLeftLobe,
+                                   int32_t aRightLobe, int32_t aTopLobe,
+                                   int32_t aBottomLobe, uint32_t aReciprocal,
+                                   int32_t aSkipX, int32_t aSkipXMost,
+                                   int32_t aSkipY, int32_t aSkipYMost) {
+  __m256i divisor = _mm256_set1_epi32(aReciprocal);
+  __m128i divisor128 = _mm_set1_epi32(aReciprocal);
+
+  // packs/packus interleave the 128-bit lanes; this puts the four groups of
+  // eight pixels back in order.
+  const __m256i unpackLanes = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+  for (int32_t y = 0; y < aHeight; y++) {
+    // Like BoxBlur_SSE2, this does not skip y == aSkipY.
+    bool inSkipRectY = y > aSkipY && y < aSkipYMost;
+
+    const uint32_t* topLeftBase =
+        aInnerIntegral +
+        ((y - aTopLobe) * ptrdiff_t(aStride32bit) - aLeftLobe);
+    const uint32_t* topRightBase =
+        aInnerIntegral +
+        ((y - aTopLobe) * ptrdiff_t(aStride32bit) + aRightLobe);
+    const uint32_t* bottomRightBase =
+        aInnerIntegral +
+        ((y + aBottomLobe) * ptrdiff_t(aStride32bit) + aRightLobe);
+    const uint32_t* bottomLeftBase =
+        aInnerIntegral +
+        ((y + aBottomLobe) * ptrdiff_t(aStride32bit) - aLeftLobe);
+
+    int32_t x = 0;
+    // Process 32 pixels at a time for as long as possible.
+    for (; x <= aWidth - 32; x += 32) {
+      if (inSkipRectY && x > aSkipX && x < aSkipXMost) {
+        x = aSkipXMost - 32;
+        inSkipRectY = false;
+        continue;
+      }
+
+      __m256i result1 =
+          BlurEightPixels(topLeftBase + x, topRightBase + x,
+                          bottomRightBase + x, bottomLeftBase + x, divisor);
+      __m256i result2 = BlurEightPixels(
+          topLeftBase + x + 8, topRightBase + x + 8, bottomRightBase + x + 8,
+          bottomLeftBase + x + 8, divisor);
+      __m256i result3 = BlurEightPixels(
+          topLeftBase + x + 16, topRightBase + x + 16, bottomRightBase + x + 16,
+          bottomLeftBase + x + 16, divisor);
+      __m256i result4 = BlurEightPixels(
+          topLeftBase + x + 24, topRightBase + x + 24, bottomRightBase + x + 24,
+          bottomLeftBase + x + 24, divisor);
+
+      __m256i packed =
+          _mm256_packus_epi16(_mm256_packs_epi32(result1, result2),
+                              _mm256_packs_epi32(result3, result4));
+
+      _mm256_storeu_si256((__m256i*)(aData + aStride * y + x),
+                          _mm256_permutevar8x32_epi32(packed, unpackLanes));
+    }
+
+    // Process the remaining pixels 4 bytes at a time. This must not read any
+    // further past the end of the row than BoxBlur_SSE2 does, since the
+    // integral image only has room for that much overrun.
+    for (; x < aWidth; x += 4) {
+      if (inSkipRectY && x > aSkipX && x < aSkipXMost) {
+        x = aSkipXMost - 4;
+        inSkipRectY = false;
+        continue;
+      }
+      __m128i topLeft = _mm_loadu_si128((const __m128i*)(topLeftBase + x));
+      __m128i topRight = _mm_loadu_si128((const __m128i*)(topRightBase + x));
+      __m128i bottomRight =
+          _mm_loadu_si128((const __m128i*)(bottomRightBase + x));
+      __m128i bottomLeft =
+          _mm_loadu_si128((const __m128i*)(bottomLeftBase + x));
+
+      __m128i values = _mm_add_epi32(
+          _mm_sub_epi32(_mm_sub_epi32(bottomRight, topRight), bottomLeft),
+          topLeft);
+      __m128i result = Divide_128(values, divisor128);
+      __m128i final = _mm_packus_epi16(
+          _mm_packs_epi32(result, _mm_setzero_si128()), _mm_setzero_si128());
+
+      *(uint32_t*)(aData + aStride * y + x) = _mm_cvtsi128_si32(final);
+    }
+  }
+}
+
+}  // namespace gfx
+}  // namespace mozilla
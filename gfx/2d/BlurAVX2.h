@@ -0,0 +1,40 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef MOZILLA_GFX_BLURAVX2_H_
+#define MOZILLA_GFX_BLURAVX2_H_
+
+// BlurAVX2.cpp is the only file built with AVX2 enabled. It must not include
+// any header with inline functions shared with the rest of gfx/2d, since the
+// linker could pick its AVX2 copies for callers running on older CPUs, so
+// this interface only uses plain types.
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace mozilla {
+namespace gfx {
+
+/**
+ * The blur pass of AlphaBoxBlur::BoxBlur_AVX2. aInnerIntegral points to the
+ * start of the rectangle within the integral image that overlaps the
+ * aWidth x aHeight surface in aData, and aStride32bit is the integral image
+ * stride in 32-bit units. aLeftLobe and aTopLobe already include the current
+ * pixel. Pixels within the open skip rect bounds are left untouched.
+ */
+void BoxBlurFromIntegralImage_AVX2(uint8_t* aData, int32_t aStride,
+                                   int32_t aWidth, int32_t aHeight,
+                                   const uint32_t* aInnerIntegral,
+                                   size_t aStride32bit, int32_t aLeftLobe,
+                                   int32_t aRightLobe, int32_t aTopLobe,
+                                   int32_t aBottomLobe, uint32_t aReciprocal,
+                                   int32_t aSkipX, int32_t aSkipXMost,
+                                   int32_t aSkipY, int32_t aSkipYMost);
+
+}  // namespace gfx
+}  // namespace mozilla
+
+#endif /* MOZILLA_GFX_BLURAVX2_H_ */
@@ -79,7 +79,7 @@ __m128i AccumulatePixelSums(__m128i aPixels) {
   return _mm_add_epi32(sumPixels, currentPixels);
 }
 
-MOZ_ALWAYS_INLINE void GenerateIntegralImage_SSE2(
+void AlphaBoxBlur::GenerateIntegralImage_SSE2(
     int32_t aLeftInflation, int32_t aRightInflation, int32_t aTopInflation,
     int32_t aBottomInflation, uint32_t* aIntegralImage,
     size_t aIntegralImageStride, uint8_t* aSource, int32_t aSourceStride,
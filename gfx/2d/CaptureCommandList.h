@@ -66,6 +66,25 @@ class CaptureCommandList {
     return Append<T>();
   }
 
+  // If the most recently appended command is of type T, destroys and
+  // removes it, and returns true.
+  template <typename T>
+  bool RemoveLastIf() {
+    if (mLastCommand == nullptr || mLastCommand->GetType() != T::Type) {
+      return false;
+    }
+    const uint16_t kAdvance = sizeof(T) + sizeof(uint16_t) + sizeof(uint16_t);
+    MOZ_ASSERT(reinterpret_cast<uint8_t*>(mLastCommand) ==
+               &mStorage.front() + mStorage.size() - kAdvance +
+                   sizeof(uint32_t));
+    reinterpret_cast<T*>(mLastCommand)->~T();
+    mStorage.resize(mStorage.size() - kAdvance);
+    // We don't track the command before this one, so nothing can be reused
+    // until the next Append().
+    mLastCommand = nullptr;
+    return true;
+  }
+
   bool IsEmpty() const { return mStorage.empty(); }
 
   template <typename T>
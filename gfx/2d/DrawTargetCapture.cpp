@@ -280,7 +280,15 @@ void DrawTargetCaptureImpl::PopLayer() {
   AppendCommand(PopLayerCommand)();
 }
 
-void DrawTargetCaptureImpl::PopClip() { AppendCommand(PopClipCommand)(); }
+void DrawTargetCaptureImpl::PopClip() {
+  // A clip that is popped with nothing recorded since it was pushed has no
+  // effect, so drop the pair instead of replaying it.
+  if (mCommands.RemoveLastIf<PushClipRectCommand>() ||
+      mCommands.RemoveLastIf<PushClipCommand>()) {
+    return;
+  }
+  AppendCommand(PopClipCommand)();
+}
 
 void DrawTargetCaptureImpl::SetTransform(const Matrix& aTransform) {
   // Save memory by eliminating state changes with no effect
@@ -23,6 +23,10 @@
 #include "nsServiceManagerUtils.h"
 #include "prsystem.h"
 
+#if defined(MOZ_MEMORY)
+#  include "mozmemory.h"
+#endif
+
 // Uncomment the following line to dispatch sync runnables when
 // painting so that rasterization happens synchronously from
 // the perspective of the main thread
@@ -94,6 +98,12 @@ bool PaintThread::Init() {
 void PaintThread::InitOnPaintThread() {
   MOZ_ASSERT(!NS_IsMainThread());
   sThreadId = PlatformThread::CurrentId();
+
+#if defined(MOZ_MEMORY)
+  // Painting allocates and frees lots of small objects; keep them out of the
+  // main arena so we don't contend with the main thread for its lock.
+  jemalloc_thread_local_arena(true);
+#endif
 }
 
 void PaintThread::InitPaintWorkers() {
@@ -521,6 +521,14 @@ StaticAutoPtr<ComputedTimingFunction> gVelocityCurveFunction;
  */
 static const double kDefaultEstimatedPaintDurationMs = 50;
 
+/**
+ * Bounds on the measured paint duration used in place of the default above.
+ * The upper bound stops a few slow paints from shifting the displayport so far
+ * ahead that the painted area no longer covers what is on screen.
+ */
+static const double kMinEstimatedPaintDurationMs = 16;
+static const double kMaxEstimatedPaintDurationMs = 100;
+
 /**
  * Returns true if this is a high memory system and we can use
  * extra memory for a larger displayport to reduce checkerboarding.
@@ -840,6 +848,7 @@ AsyncPanZoomController::AsyncPanZoomController(
       mTreeManager(aTreeManager),
       mRecursiveMutex("AsyncPanZoomController"),
       mLastContentPaintMetrics(mLastContentPaintMetadata.GetMetrics()),
+      mEstimatedPaintDurationMs(kDefaultEstimatedPaintDurationMs),
       mX(this),
       mY(this),
       mPanDirRestricted(false),
@@ -3737,7 +3746,8 @@ static void RedistributeDisplayPortExcess(CSSSize& aDisplayPortSize,
 
 /* static */
 const ScreenMargin AsyncPanZoomController::CalculatePendingDisplayPort(
-    const FrameMetrics& aFrameMetrics, const ParentLayerPoint& aVelocity) {
+    const FrameMetrics& aFrameMetrics, const ParentLayerPoint& aVelocity,
+    const Maybe<double>& aEstimatedPaintDurationMs) {
   if (aFrameMetrics.IsScrollInfoLayer()) {
     // Don't compute margins. Since we can't asynchronously scroll this frame,
     // we don't want to paint anything more than the composition bounds.
@@ -3777,7 +3787,8 @@ const ScreenMargin AsyncPanZoomController::CalculatePendingDisplayPort(
 
   // Offset the displayport, depending on how fast we're moving and the
   // estimated time it takes to paint, to try to minimise checkerboarding.
-  float paintFactor = kDefaultEstimatedPaintDurationMs;
+  float paintFactor =
+      aEstimatedPaintDurationMs.valueOr(kDefaultEstimatedPaintDurationMs);
   displayPort.MoveBy(velocity * paintFactor * StaticPrefs::APZVelocityBias());
 
   APZC_LOG_FM(
@@ -3890,8 +3901,8 @@ void AsyncPanZoomController::RequestContentRepaint(
 
   RecursiveMutexAutoLock lock(mRecursiveMutex);
   ParentLayerPoint velocity = GetVelocityVector();
-  Metrics().SetDisplayPortMargins(
-      CalculatePendingDisplayPort(Metrics(), velocity));
+  Metrics().SetDisplayPortMargins(CalculatePendingDisplayPort(
+      Metrics(), velocity, Some(mEstimatedPaintDurationMs)));
   Metrics().SetPaintRequestTime(TimeStamp::Now());
   RequestContentRepaint(Metrics(), velocity, aUpdateType);
 }
@@ -4459,6 +4470,18 @@ void AsyncPanZoomController::NotifyLayersUpdated(
               "aThisLayerTreeUpdated=%d",
               this, aIsFirstPaint, aThisLayerTreeUpdated);
 
+  if (aThisLayerTreeUpdated && !aLayerMetrics.GetPaintRequestTime().IsNull()) {
+    // Fold the time content took to respond to our repaint request into the
+    // estimate used to position the next displayport. As below, a non-null
+    // paint request time without aThisLayerTreeUpdated was already counted.
+    double paintTimeMs =
+        (TimeStamp::Now() - aLayerMetrics.GetPaintRequestTime())
+            .ToMilliseconds();
+    mEstimatedPaintDurationMs =
+        clamped(0.75 * mEstimatedPaintDurationMs + 0.25 * paintTimeMs,
+                kMinEstimatedPaintDurationMs, kMaxEstimatedPaintDurationMs);
+  }
+
   {  // scope lock
     MutexAutoLock lock(mCheckerboardEventLock);
     if (mCheckerboardEvent && mCheckerboardEvent->IsRecordingTrace()) {
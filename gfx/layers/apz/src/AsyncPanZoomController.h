@@ -338,9 +338,12 @@ class AsyncPanZoomController {
    * than the composite-to dimensions so that when you scroll down, you don't
    * checkerboard immediately. This includes a bunch of logic, including
    * algorithms to bias painting in the direction of the velocity.
+   * If aEstimatedPaintDurationMs is given, the displayport is shifted ahead
+   * of the velocity by that much time rather than by a fixed default.
    */
   static const ScreenMargin CalculatePendingDisplayPort(
-      const FrameMetrics& aFrameMetrics, const ParentLayerPoint& aVelocity);
+      const FrameMetrics& aFrameMetrics, const ParentLayerPoint& aVelocity,
+      const Maybe<double>& aEstimatedPaintDurationMs = Nothing());
 
   nsEventStatus HandleDragEvent(const MouseInput& aEvent,
                                 const AsyncDragMetrics& aDragMetrics,
@@ -976,6 +979,9 @@ class AsyncPanZoomController {
   ScrollMetadata mLastContentPaintMetadata;
   FrameMetrics& mLastContentPaintMetrics;  // for convenience, refers to
                                            // mLastContentPaintMetadata.mMetrics
+  // A running estimate of how long content takes to paint after we request a
+  // repaint, used to shift the displayport ahead of the scroll velocity.
+  double mEstimatedPaintDurationMs;
   // The last content repaint request.
   RepaintRequest mLastPaintRequestMetrics;
   // The metrics that we expect content to have. This is updated when we
@@ -229,6 +229,13 @@ bool HitTestingTreeNode::IsOutsideClip(const ParentLayerPoint& aPoint) const {
 Maybe<LayerPoint> HitTestingTreeNode::Untransform(
     const ParentLayerPoint& aPoint,
     const LayerToParentLayerMatrix4x4& aTransform) const {
+  // Most nodes are only translated relative to their parent, so avoid
+  // inverting the full 4x4 matrix for each node visited during hit testing.
+  if (aTransform.Is2D() && aTransform._11 == 1.0f && aTransform._12 == 0.0f &&
+      aTransform._21 == 0.0f && aTransform._22 == 1.0f) {
+    return Some(
+        LayerPoint(aPoint.x - aTransform._41, aPoint.y - aTransform._42));
+  }
   Maybe<ParentLayerToLayerMatrix4x4> inverse = aTransform.MaybeInverse();
   if (inverse) {
     return UntransformBy(inverse.ref(), aPoint);
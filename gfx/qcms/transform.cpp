@@ -1130,6 +1130,53 @@ qcms_transform* qcms_transform_precacheLUT_float(qcms_transform *transform, qcms
 	return transform;
 }
 
+static void qcms_transform_data_copy_rgb(const qcms_transform *transform, const unsigned char *src, unsigned char *dest, size_t length)
+{
+	if (src != dest)
+		memcpy(dest, src, length * 3);
+}
+
+static void qcms_transform_data_copy_rgba(const qcms_transform *transform, const unsigned char *src, unsigned char *dest, size_t length)
+{
+	if (src != dest)
+		memcpy(dest, src, length * 4);
+}
+
+#define PARAMETRIC_CURVE_TYPE 0x70617261 //'para'
+
+static bool curves_equal(const struct curveType *a, const struct curveType *b)
+{
+	static const int parametric_length[5] = {1, 3, 4, 5, 7};
+
+	if (!a || !b || a->type != b->type || a->count != b->count)
+		return false;
+	if (a->type != PARAMETRIC_CURVE_TYPE)
+		return memcmp(a->data, b->data, sizeof(uInt16Number) * a->count) == 0;
+	if (a->count > 4)
+		return false;
+	return memcmp(a->parameter, b->parameter, sizeof(float) * parametric_length[a->count]) == 0;
+}
+
+// Returns true if transforming from |in| to |out| leaves every pixel unchanged,
+// which is the case when both are the same matrix/TRC RGB profile. This is
+// common when the output profile is sRGB, e.g. when no display profile is
+// available and images are assumed to be sRGB.
+static bool profiles_equivalent(const qcms_profile *in, const qcms_profile *out)
+{
+	if (in == out)
+		return in->color_space == RGB_SIGNATURE && !in->A2B0 && !in->mAB;
+	if (in->color_space != RGB_SIGNATURE || out->color_space != RGB_SIGNATURE)
+		return false;
+	if (in->A2B0 || in->mAB || out->B2A0 || out->mBA)
+		return false;
+	return memcmp(&in->redColorant, &out->redColorant, sizeof(struct XYZNumber)) == 0 &&
+	       memcmp(&in->greenColorant, &out->greenColorant, sizeof(struct XYZNumber)) == 0 &&
+	       memcmp(&in->blueColorant, &out->blueColorant, sizeof(struct XYZNumber)) == 0 &&
+	       curves_equal(in->redTRC, out->redTRC) &&
+	       curves_equal(in->greenTRC, out->greenTRC) &&
+	       curves_equal(in->blueTRC, out->blueTRC);
+}
+
 #define NO_MEM_TRANSFORM NULL
 
 qcms_transform* qcms_transform_create(
@@ -1160,6 +1207,15 @@ qcms_transform* qcms_transform_create(
 		return NULL;
 	}
 
+	if (in_type == out_type && profiles_equivalent(in, out)) {
+		if (in_type == QCMS_DATA_RGB_8) {
+			transform->transform_fn = qcms_transform_data_copy_rgb;
+		} else {
+			transform->transform_fn = qcms_transform_data_copy_rgba;
+		}
+		return transform;
+	}
+
 	bool precache = false;
 	if (out->output_table_r &&
 			out->output_table_g &&
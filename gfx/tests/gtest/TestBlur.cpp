@@ -0,0 +1,50 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "gtest/gtest.h"
+#include "gtest/MozGTestBench.h"  // For MOZ_GTEST_BENCH
+#include "mozilla/UniquePtr.h"
+#include "mozilla/gfx/Blur.h"
+
+#include <string.h>
+
+using namespace mozilla;
+using namespace mozilla::gfx;
+
+// Blurs an opaque square, the size of a typical box-shadow, a few times.
+static void BenchBlur(int32_t aSize, int32_t aRadius, bool aUseSkipRect) {
+  Rect rect(0, 0, aSize, aSize);
+  Rect skipRect(aSize / 4, aSize / 4, aSize / 2, aSize / 2);
+  AlphaBoxBlur blur(rect, IntSize(0, 0), IntSize(aRadius, aRadius), nullptr,
+                    aUseSkipRect ? &skipRect : nullptr);
+  size_t length = blur.GetSurfaceAllocationSize();
+  MOZ_RELEASE_ASSERT(length);
+
+  IntSize size = blur.GetSize();
+  int32_t stride = blur.GetStride();
+  UniquePtr<uint8_t[]> data = MakeUnique<uint8_t[]>(length);
+
+  for (int i = 0; i < 10; i++) {
+    memset(data.get(), 0, length);
+    for (int32_t y = aRadius; y < size.height - aRadius; y++) {
+      memset(data.get() + y * stride + aRadius, 0xFF, size.width - 2 * aRadius);
+    }
+
+    blur.Blur(data.get());
+
+    // The corners of the inflated surface only get a fraction of the
+    // coverage, and the middle stays fully covered.
+    MOZ_RELEASE_ASSERT(data[0] < 0xFF);
+    MOZ_RELEASE_ASSERT(data[(size.height / 2) * stride + size.width / 2] ==
+                       0xFF);
+  }
+}
+
+MOZ_GTEST_BENCH(Moz2D, BlurSmallRadius, [] { BenchBlur(512, 4, false); });
+
+MOZ_GTEST_BENCH(Moz2D, BlurLargeRadius, [] { BenchBlur(512, 32, false); });
+
+MOZ_GTEST_BENCH(Moz2D, BlurSkipRect, [] { BenchBlur(512, 16, true); });
@@ -1257,6 +1257,7 @@ void gfxFT2FontList::FindFonts() {
 
   mCodepointsWithNoFonts.SetRange(0, 0x1f);     // C0 controls
   mCodepointsWithNoFonts.SetRange(0x7f, 0x9f);  // C1 controls
+  mFallbackFamilyForBlock.Clear();
 
   if (!XRE_IsParentProcess()) {
     // Content process: ask the Chrome process to give us the list
@@ -2596,6 +2596,22 @@ void gfxFont::AgeCachedWords() {
   }
 }
 
+void gfxFont::TrimCachedWords(uint32_t aMaxEntries) {
+  if (!mWordCache) {
+    return;
+  }
+  for (auto it = mWordCache->Iter(); !it.Done(); it.Next()) {
+    CacheHashEntry* entry = it.Get();
+    if (!entry->mShapedWord || entry->mShapedWord->GetAge() > 0) {
+      it.Remove();
+    }
+  }
+  if (mWordCache->Count() > aMaxEntries) {
+    NS_WARNING("flushing shaped-word cache");
+    ClearCachedWords();
+  }
+}
+
 void gfxFont::NotifyGlyphsChanged() {
   uint32_t i, count = mGlyphExtentsArray.Length();
   for (i = 0; i < count; ++i) {
@@ -2631,12 +2647,12 @@ gfxShapedWord* gfxFont::GetShapedWord(
     Script aRunScript, bool aVertical, int32_t aAppUnitsPerDevUnit,
     gfx::ShapedTextFlags aFlags, RoundingFlags aRounding,
     gfxTextPerfMetrics* aTextPerf GFX_MAYBE_UNUSED) {
-  // if the cache is getting too big, flush it and start over
+  // if the cache is getting too big, drop the words that haven't been used
+  // recently (or, failing that, flush it and start over)
   uint32_t wordCacheMaxEntries =
       gfxPlatform::GetPlatform()->WordCacheMaxEntries();
   if (mWordCache->Count() > wordCacheMaxEntries) {
-    NS_WARNING("flushing shaped-word cache");
-    ClearCachedWords();
+    TrimCachedWords(wordCacheMaxEntries);
   }
 
   // if there's a cached entry for this word, just return it
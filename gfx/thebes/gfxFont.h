@@ -1283,6 +1283,7 @@ class gfxShapedWord final : public gfxShapedText {
 
   void ResetAge() { mAgeCounter = 0; }
   uint32_t IncrementAge() { return ++mAgeCounter; }
+  uint32_t GetAge() const { return mAgeCounter; }
 
   // Helper used when hashing a word for the shaped-word caches
   static uint32_t HashMix(uint32_t aHash, char16_t aCh) {
@@ -1773,6 +1774,11 @@ class gfxFont {
   // so that they'll expire after a sufficient period of non-use
   void AgeCachedWords();
 
+  // Called when the word cache has grown too large: discard the words that
+  // have not been used since the last aging pass, and flush the whole cache
+  // only if that doesn't bring it back under aMaxEntries.
+  void TrimCachedWords(uint32_t aMaxEntries);
+
   // Discard all cached word records; called on memory-pressure notification.
   void ClearCachedWords() {
     if (mWordCache) {
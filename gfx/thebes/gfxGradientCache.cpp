@@ -94,8 +94,8 @@ struct GradientCacheData {
 };
 
 /**
- * This class implements a cache with no maximum size, that retains the
- * gfxPatterns used to draw the gradients.
+ * This class implements a cache of at most MAX_ENTRIES entries, that retains
+ * the gfxPatterns used to draw the gradients.
  *
  * The key is the nsStyleGradient that defines the gradient, and the size of the
  * gradient.
@@ -147,11 +147,37 @@ class GradientCache final : public nsExpirationTracker<GradientCacheData, 4> {
       return false;
     }
     mHashEntries.Put(aValue->mKey, aValue);
+    if (mHashEntries.Count() > MAX_ENTRIES) {
+      EvictFromOldestGeneration(aValue->GetExpirationState()->mGeneration);
+    }
     return true;
   }
 
+ private:
+  // Expires just enough entries from the oldest generation to bring the cache
+  // back down to MAX_ENTRIES. Entries in the newer generations were used
+  // recently, so they are kept even if that leaves the cache over the limit
+  // until the timer ages the oldest generation out.
+  void EvictFromOldestGeneration(uint32_t aNewestGeneration) {
+    // AgeOneGeneration() reaps the generation just before the newest one.
+    const uint32_t oldestGeneration = (aNewestGeneration + 4 - 1) % 4;
+    const uint32_t excess = mHashEntries.Count() - MAX_ENTRIES;
+    AutoTArray<GradientCacheData*, 1> expired;
+    for (auto iter = mHashEntries.Iter();
+         !iter.Done() && expired.Length() < excess; iter.Next()) {
+      GradientCacheData* data = iter.UserData();
+      if (data->GetExpirationState()->mGeneration == oldestGeneration) {
+        expired.AppendElement(data);
+      }
+    }
+    for (GradientCacheData* data : expired) {
+      NotifyExpired(data);
+    }
+  }
+
  protected:
   static const uint32_t MAX_GENERATION_MS = 10000;
+  static const uint32_t MAX_ENTRIES = 1024;
   /**
    * FIXME use nsTHashtable to avoid duplicating the GradientCacheKey.
    * https://bugzilla.mozilla.org/show_bug.cgi?id=761393#c47
@@ -413,6 +413,7 @@ nsresult gfxPlatformFontList::InitFontList() {
   mCodepointsWithNoFonts.reset();
   mCodepointsWithNoFonts.SetRange(0, 0x1f);     // C0 controls
   mCodepointsWithNoFonts.SetRange(0x7f, 0x9f);  // C1 controls
+  mFallbackFamilyForBlock.Clear();
 
   sPlatformFontList = this;
 
@@ -714,20 +715,8 @@ gfxFontEntry* gfxPlatformFontList::SystemFindFontForChar(
   // This helps speed up pages with lots of encoding errors, binary-as-text,
   // etc.
   if (aCh == 0xFFFD) {
-    if (mReplacementCharFallbackFamily.mIsShared &&
-        mReplacementCharFallbackFamily.mShared) {
-      fontlist::Face* face =
-          mReplacementCharFallbackFamily.mShared->FindFaceForStyle(
-              SharedFontList(), *aStyle);
-      if (face) {
-        fontEntry =
-            GetOrCreateFontEntry(face, mReplacementCharFallbackFamily.mShared);
-      }
-    } else if (!mReplacementCharFallbackFamily.mIsShared &&
-               mReplacementCharFallbackFamily.mUnshared) {
-      fontEntry =
-          mReplacementCharFallbackFamily.mUnshared->FindFontForStyle(*aStyle);
-    }
+    fontEntry =
+        FindFontForStyleInFamily(mReplacementCharFallbackFamily, aStyle);
 
     // this should never fail, as we must have found U+FFFD in order to set
     // mReplacementCharFallbackFamily at all, but better play it safe
@@ -746,10 +735,33 @@ gfxFontEntry* gfxPlatformFontList::SystemFindFontForChar(
 
   // if didn't find a font, do system-wide fallback (except for specials)
   uint32_t cmapCount = 0;
+  bool cached = false;
   if (!fontEntry) {
     common = false;
-    fontEntry =
-        GlobalFontFallback(aCh, aRunScript, aStyle, cmapCount, &fallbackFamily);
+
+    // Characters that need system-wide fallback tend to come in runs from the
+    // same block (CJK ideographs, emoji, ...), and the family that covered the
+    // last one usually covers this one too, so try that before searching
+    // every family's cmap again.
+    FallbackBlockKey blockKey(aCh, aRunScript, aStyle);
+    FontFamily blockFamily;
+    if (mFallbackFamilyForBlock.Get(blockKey, &blockFamily)) {
+      fontEntry = FindFontForStyleInFamily(blockFamily, aStyle);
+      if (fontEntry && fontEntry->HasCharacter(aCh)) {
+        fallbackFamily = blockFamily;
+        cached = true;
+      } else {
+        fontEntry = nullptr;
+      }
+    }
+
+    if (!fontEntry) {
+      fontEntry = GlobalFontFallback(aCh, aRunScript, aStyle, cmapCount,
+                                     &fallbackFamily);
+      if (fontEntry && !fallbackFamily.IsNull()) {
+        mFallbackFamilyForBlock.Put(blockKey, fallbackFamily);
+      }
+    }
   }
   TimeDuration elapsed = TimeStamp::Now() - start;
 
@@ -761,7 +773,8 @@ gfxFontEntry* gfxPlatformFontList::SystemFindFontForChar(
             ("(textrun-systemfallback-%s) char: u+%6.6x "
              "script: %d match: [%s]"
              " time: %dus cmaps: %d\n",
-             (common ? "common" : "global"), aCh, static_cast<int>(script),
+             (common ? "common" : (cached ? "cached" : "global")), aCh,
+             static_cast<int>(script),
              (fontEntry ? fontEntry->Name().get() : "<none>"),
              int32_t(elapsed.ToMicroseconds()), cmapCount));
   }
@@ -773,14 +786,17 @@ gfxFontEntry* gfxPlatformFontList::SystemFindFontForChar(
     mReplacementCharFallbackFamily = fallbackFamily;
   }
 
-  // track system fallback time
+  // track system fallback time; a hit in mFallbackFamilyForBlock searched
+  // no cmaps, so leave it out rather than report it as a fast global search
   static bool first = true;
-  int32_t intElapsed =
-      int32_t(first ? elapsed.ToMilliseconds() : elapsed.ToMicroseconds());
-  Telemetry::Accumulate((first ? Telemetry::SYSTEM_FONT_FALLBACK_FIRST
-                               : Telemetry::SYSTEM_FONT_FALLBACK),
-                        intElapsed);
-  first = false;
+  if (!cached) {
+    int32_t intElapsed =
+        int32_t(first ? elapsed.ToMilliseconds() : elapsed.ToMicroseconds());
+    Telemetry::Accumulate((first ? Telemetry::SYSTEM_FONT_FALLBACK_FIRST
+                                 : Telemetry::SYSTEM_FONT_FALLBACK),
+                          intElapsed);
+    first = false;
+  }
 
   // track the script for which fallback occurred (incremented one make it
   // 1-based)
@@ -830,6 +846,20 @@ gfxFontEntry* gfxPlatformFontList::CommonFontFallback(
   return nullptr;
 }
 
+gfxFontEntry* gfxPlatformFontList::FindFontForStyleInFamily(
+    const FontFamily& aFamily, const gfxFontStyle* aStyle) {
+  if (aFamily.mIsShared) {
+    if (!aFamily.mShared) {
+      return nullptr;
+    }
+    fontlist::Face* face =
+        aFamily.mShared->FindFaceForStyle(SharedFontList(), *aStyle);
+    return face ? GetOrCreateFontEntry(face, aFamily.mShared) : nullptr;
+  }
+  return aFamily.mUnshared ? aFamily.mUnshared->FindFontForStyle(*aStyle)
+                           : nullptr;
+}
+
 gfxFontEntry* gfxPlatformFontList::GlobalFontFallback(
     const uint32_t aCh, Script aRunScript, const gfxFontStyle* aMatchStyle,
     uint32_t& aCmapCount, FontFamily* aMatchedFamily) {
@@ -1952,6 +1982,8 @@ void gfxPlatformFontList::AddSizeOfExcludingThis(MallocSizeOf aMallocSizeOf,
 
   aSizes->mFontListSize +=
       mCodepointsWithNoFonts.SizeOfExcludingThis(aMallocSizeOf);
+  aSizes->mFontListSize +=
+      mFallbackFamilyForBlock.ShallowSizeOfExcludingThis(aMallocSizeOf);
   aSizes->mFontListSize +=
       mFontFamiliesToLoad.ShallowSizeOfExcludingThis(aMallocSizeOf);
 
@@ -567,6 +567,43 @@ class gfxPlatformFontList : public gfxFontInfoLoader {
                                    const gfxFontStyle* aMatchStyle,
                                    FontFamily* aMatchedFamily);
 
+  // Key for mFallbackFamilyForBlock: the block of 256 codepoints and run
+  // script, plus the parts of the style that affect which family system
+  // fallback picks (face matching and lang-based preferences).
+  struct FallbackBlockKey {
+    FallbackBlockKey(uint32_t aCh, Script aRunScript,
+                     const gfxFontStyle* aStyle)
+        : mBlock(aCh >> 8),
+          mScript(aRunScript),
+          mWeight(aStyle->weight),
+          mStretch(aStyle->stretch),
+          mStyle(aStyle->style),
+          mLanguage(aStyle->language) {}
+
+    PLDHashNumber Hash() const {
+      return mozilla::AddToHash(
+          mozilla::HashGeneric(mBlock, uint32_t(mScript)), mWeight.ForHash(),
+          mStretch.ForHash(), mStyle.ForHash(),
+          nsRefPtrHashKey<nsAtom>::HashKey(mLanguage));
+    }
+    bool operator==(const FallbackBlockKey& aOther) const {
+      return mBlock == aOther.mBlock && mScript == aOther.mScript &&
+             mWeight == aOther.mWeight && mStretch == aOther.mStretch &&
+             mStyle == aOther.mStyle && mLanguage == aOther.mLanguage;
+    }
+
+    uint32_t mBlock;
+    Script mScript;
+    FontWeight mWeight;
+    FontStretch mStretch;
+    FontSlantStyle mStyle;
+    RefPtr<nsAtom> mLanguage;
+  };
+
+  // Returns the face in aFamily that best matches aStyle, or null.
+  gfxFontEntry* FindFontForStyleInFamily(const FontFamily& aFamily,
+                                         const gfxFontStyle* aStyle);
+
   // Search fonts system-wide for a given character, null if not found.
   gfxFontEntry* GlobalFontFallback(const uint32_t aCh, Script aRunScript,
                                    const gfxFontStyle* aMatchStyle,
@@ -751,6 +788,12 @@ class gfxPlatformFontList : public gfxFontInfoLoader {
   // on pages with lots of problems
   FontFamily mReplacementCharFallbackFamily;
 
+  // the family most recently chosen by system-wide fallback for each block of
+  // 256 codepoints in a given script, tried before doing another full search
+  // for a neighbouring character with the same style and language
+  nsDataHashtable<nsGenericHashKey<FallbackBlockKey>, FontFamily>
+      mFallbackFamilyForBlock;
+
   // Sorted array of lowercased family names; use ContainsSorted to test
   nsTArray<nsCString> mBadUnderlineFamilyNames;
 
@@ -1130,6 +1130,15 @@ class SurfaceCacheImpl final : public nsIMemoryReporter {
       return;
     }
 
+    // Surfaces that haven't been used since the tracker last aged are the
+    // least likely to be needed again, whereas anything visible gets marked
+    // used on every paint. Expire the stale ones first, even if that frees
+    // more than the target, so that we don't discard a large surface that is
+    // still on screen while a stale one survives.
+    if (mAvailableCost < targetCost) {
+      mExpirationTracker.AgeOneGenerationLocked(aAutoLock);
+    }
+
     // Discard surfaces until we've reduced our cost to our target cost.
     while (mAvailableCost < targetCost) {
       MOZ_ASSERT(!mCosts.IsEmpty(), "Removed everything and still not done");
@@ -345,6 +345,23 @@ LexerTransition<nsJPEGDecoder::State> nsJPEGDecoder::ReadJPEGData(
       mInfo.buffered_image =
           mDecodeStyle == PROGRESSIVE && jpeg_has_multiple_scans(&mInfo);
 
+      // If we're downscaling during decode, let libjpeg do as much of the
+      // work as it can in the DCT domain, which is much cheaper than decoding
+      // at full size. We stop at the largest scale that is still at least as
+      // big as the output size, so the downscaler does the final reduction.
+      if (OutputSize() != Size()) {
+        for (uint32_t denom = 8; denom > 1; denom /= 2) {
+          if ((mInfo.image_width + denom - 1) / denom >=
+                  uint32_t(OutputSize().width) &&
+              (mInfo.image_height + denom - 1) / denom >=
+                  uint32_t(OutputSize().height)) {
+            mInfo.scale_num = 1;
+            mInfo.scale_denom = denom;
+            break;
+          }
+        }
+      }
+
       /* Used to set up image size so arrays can be allocated */
       jpeg_calc_output_dimensions(&mInfo);
 
@@ -355,8 +372,12 @@ LexerTransition<nsJPEGDecoder::State> nsJPEGDecoder::ReadJPEGData(
       qcms_transform* pipeTransform =
           mInfo.out_color_space != JCS_GRAYSCALE ? mTransform : nullptr;
 
+      // The pipe takes the rows as libjpeg produces them, which may already
+      // have been scaled down above.
+      gfx::IntSize decodedSize(mInfo.output_width, mInfo.output_height);
       Maybe<SurfacePipe> pipe = SurfacePipeFactory::CreateSurfacePipe(
-          this, Size(), OutputSize(), FullFrame(), SurfaceFormat::B8G8R8X8,
+          this, decodedSize, OutputSize(),
+          gfx::IntRect(gfx::IntPoint(), decodedSize), SurfaceFormat::B8G8R8X8,
           Nothing(), pipeTransform, SurfacePipeFlags());
       if (!pipe) {
         mState = JPEG_ERROR;
@@ -621,8 +642,16 @@ WriteState nsJPEGDecoder::OutputScanlines() {
 
   Maybe<SurfaceInvalidRect> invalidRect = mPipe.TakeInvalidRect();
   if (invalidRect) {
-    PostInvalidation(invalidRect->mInputSpaceRect,
-                     Some(invalidRect->mOutputSpaceRect));
+    // Map the rect back from the DCT-scaled size to the image's real size.
+    gfx::IntRect inputSpaceRect = invalidRect->mInputSpaceRect;
+    if (mInfo.output_width != mInfo.image_width ||
+        mInfo.output_height != mInfo.image_height) {
+      inputSpaceRect.ScaleRoundOut(
+          double(mInfo.image_width) / mInfo.output_width,
+          double(mInfo.image_height) / mInfo.output_height);
+      inputSpaceRect = inputSpaceRect.Intersect(FullFrame());
+    }
+    PostInvalidation(inputSpaceRect, Some(invalidRect->mOutputSpaceRect));
   }
 
   return result;
@@ -35,6 +35,14 @@ static const uint32_t kHeaderSegmentCapacity = 64;
 static const uint32_t kHeaderSegmentCapacity = 128;
 #endif
 
+// The first segment holds the header and the start of the payload. Most
+// messages are small, so make it big enough for their whole payload to fit:
+// that's the difference between one allocation for the message's data and
+// three (the first segment, a standard one, and growing the segment vector).
+static const uint32_t kInitialSegmentCapacity = 512;
+static_assert(kHeaderSegmentCapacity <= kInitialSegmentCapacity,
+              "The header must fit in the first segment");
+
 static const uint32_t kDefaultSegmentCapacity = 4096;
 
 static const char kBytePaddingMarker = char(0xbf);
@@ -128,7 +136,7 @@ void Pickle::UpdateIter(PickleIterator* iter, uint32_t bytes) const {
 
 Pickle::Pickle(uint32_t header_size, size_t segment_capacity)
     : buffers_(AlignInt(header_size),
-               segment_capacity ? segment_capacity : kHeaderSegmentCapacity,
+               segment_capacity ? segment_capacity : kInitialSegmentCapacity,
                segment_capacity ? segment_capacity : kDefaultSegmentCapacity),
       header_(nullptr),
       header_size_(AlignInt(header_size)) {
@@ -138,8 +146,10 @@ Pickle::Pickle(uint32_t header_size, size_t segment_capacity)
   header_->payload_size = 0;
 }
 
-Pickle::Pickle(uint32_t header_size, const char* data, uint32_t length)
-    : buffers_(length, AlignCapacity(length), kDefaultSegmentCapacity),
+Pickle::Pickle(uint32_t header_size, const char* data, uint32_t length,
+               uint32_t capacity)
+    : buffers_(length, AlignCapacity(std::max(length, capacity)),
+               kDefaultSegmentCapacity),
       header_(nullptr),
       header_size_(AlignInt(header_size)) {
   DCHECK(static_cast<memberAlignmentType>(header_size) >= sizeof(Header));
@@ -66,7 +66,12 @@ class Pickle {
   // will be rounded up to ensure that the header size is 32bit-aligned.
   explicit Pickle(uint32_t header_size, size_t segment_capacity = 0);
 
-  Pickle(uint32_t header_size, const char* data, uint32_t length);
+  // Initialize a Pickle object from the first |length| bytes of a serialized
+  // pickle.  If |capacity| is larger than |length|, that many bytes are
+  // reserved up front so that the rest of the data can be appended with
+  // InputBytes() without allocating further segments.
+  Pickle(uint32_t header_size, const char* data, uint32_t length,
+         uint32_t capacity = 0);
 
   Pickle(const Pickle& other) = delete;
 
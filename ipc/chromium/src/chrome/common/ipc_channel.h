@@ -54,6 +54,10 @@ class Channel {
 
     // Maximum size of a message that we allow to be copied (rather than moved).
     kMaxCopySize = 32 * 1024,
+
+    // Maximum size of a partially received message for which we reserve
+    // the whole buffer up front, rather than growing it as data arrives.
+    kMaxPreallocatedMessageSize = 16 * 1024 * 1024,
   };
 
   // Initialize a Channel.
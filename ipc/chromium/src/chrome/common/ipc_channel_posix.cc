@@ -505,7 +505,16 @@ bool Channel::ChannelImpl::ProcessIncomingMessages() {
         // How much data from this message is stored in input_buf_?
         uint32_t in_buf = std::min(message_length, uint32_t(end - p));
 
-        incoming_message_.emplace(p, in_buf);
+        // If we only have the start of a large message, reserve room for the
+        // rest of it now so that it ends up in one contiguous buffer instead
+        // of being split across many small segments as it trickles in.
+        uint32_t capacity = 0;
+        if (in_buf != message_length &&
+            message_length <= Channel::kMaxPreallocatedMessageSize) {
+          capacity = message_length;
+        }
+
+        incoming_message_.emplace(p, in_buf, capacity);
         p += in_buf;
 
         // Are we done reading this message?
@@ -668,6 +677,7 @@ bool Channel::ChannelImpl::ProcessOutgoingMessages() {
     iov_count++;
 
     // Store remaining segments to write into iovec.
+    bool all_segments_in_iov = true;
     while (!iter.Done()) {
       char* data = iter.Data();
       size_t size = iter.RemainingInSegment();
@@ -678,10 +688,44 @@ bool Channel::ChannelImpl::ProcessOutgoingMessages() {
         iov[iov_count].iov_base = data;
         iov[iov_count].iov_len = size;
         iov_count++;
+      } else {
+        all_segments_in_iov = false;
       }
       amt_to_write += size;
       iter.Advance(msg->Buffers(), size);
     }
+    const size_t msg_amt_to_write = amt_to_write;
+
+    // Pack the messages queued behind this one into the same sendmsg(), which
+    // saves a system call per message here and lets the other side read them
+    // all in one wakeup. A message with descriptors to send has to start its
+    // own sendmsg(), and we only take messages that fit in the iovec whole.
+    size_t batched_count = 0;
+    if (all_segments_in_iov) {
+      for (auto next = output_queue_.begin() + 1; next != output_queue_.end();
+           ++next) {
+        if (!(*next)->file_descriptor_set()->empty()) {
+          break;
+        }
+
+        size_t first_iov = iov_count;
+        Pickle::BufferList::IterImpl next_iter((*next)->Buffers());
+        while (!next_iter.Done() && iov_count < kMaxIOVecSize) {
+          size_t size = next_iter.RemainingInSegment();
+          iov[iov_count].iov_base = next_iter.Data();
+          iov[iov_count].iov_len = size;
+          iov_count++;
+          next_iter.Advance((*next)->Buffers(), size);
+        }
+        if (!next_iter.Done()) {
+          iov_count = first_iov;
+          break;
+        }
+
+        amt_to_write += (*next)->Buffers().Size();
+        batched_count++;
+      }
+    }
 
     msgh.msg_iov = iov;
     msgh.msg_iovlen = iov_count;
@@ -730,7 +774,51 @@ bool Channel::ChannelImpl::ProcessOutgoingMessages() {
       }
     }
 
-    if (static_cast<size_t>(bytes_written) != amt_to_write) {
+    if (bytes_written > 0 && batched_count &&
+        static_cast<size_t>(bytes_written) >= msg_amt_to_write) {
+      // The first message went out, pop it and whichever of the messages
+      // batched with it went out completely too.
+      partial_write_iter_.reset();
+#if defined(OS_MACOSX)
+      if (!msg->file_descriptor_set()->empty())
+        pending_fds_.push_back(
+            PendingDescriptors(msg->fd_cookie(), msg->file_descriptor_set()));
+#endif
+      OutputQueuePop();
+      delete msg;
+
+      size_t remaining = bytes_written - msg_amt_to_write;
+      for (; batched_count; batched_count--) {
+        Message* next = output_queue_.front();
+        size_t size = next->Buffers().Size();
+        if (remaining < size) {
+          if (remaining) {
+            Pickle::BufferList::IterImpl iter(next->Buffers());
+            partial_write_iter_.emplace(iter);
+            partial_write_iter_.ref().AdvanceAcrossSegments(next->Buffers(),
+                                                            remaining);
+          }
+          break;
+        }
+        remaining -= size;
+        OutputQueuePop();
+        delete next;
+      }
+
+      if (!batched_count) {
+        continue;
+      }
+
+      // Tell libevent to call us back once things are unblocked.
+      is_blocked_on_write_ = true;
+      MessageLoopForIO::current()->WatchFileDescriptor(
+          pipe_,
+          false,  // One shot
+          MessageLoopForIO::WATCH_WRITE, &write_watcher_, this);
+      return true;
+    }
+
+    if (static_cast<size_t>(bytes_written) != msg_amt_to_write) {
       // If write() fails with EAGAIN then bytes_written will be -1.
       if (bytes_written > 0) {
         partial_write_iter_.ref().AdvanceAcrossSegments(msg->Buffers(),
@@ -844,12 +932,12 @@ void Channel::ChannelImpl::CloseDescriptors(uint32_t pending_fd_id) {
 #endif
 
 void Channel::ChannelImpl::OutputQueuePush(Message* msg) {
-  output_queue_.push(msg);
+  output_queue_.push_back(msg);
   output_queue_length_++;
 }
 
 void Channel::ChannelImpl::OutputQueuePop() {
-  output_queue_.pop();
+  output_queue_.pop_front();
   output_queue_length_--;
 }
 
@@ -399,7 +399,16 @@ bool Channel::ChannelImpl::ProcessIncomingMessages(
         // How much data from this message is stored in input_buf_?
         uint32_t in_buf = std::min(message_length, uint32_t(end - p));
 
-        incoming_message_.emplace(p, in_buf);
+        // If we only have the start of a large message, reserve room for the
+        // rest of it now so that it ends up in one contiguous buffer instead
+        // of being split across many small segments as it trickles in.
+        uint32_t capacity = 0;
+        if (in_buf != message_length &&
+            message_length <= Channel::kMaxPreallocatedMessageSize) {
+          capacity = message_length;
+        }
+
+        incoming_message_.emplace(p, in_buf, capacity);
         p += in_buf;
 
         // Are we done reading this message?
@@ -90,8 +90,8 @@ Message::Message(int32_t routing_id, msgid_t type, uint32_t segment_capacity,
          : sizeof(Header))
 #endif
 
-Message::Message(const char* data, int data_len)
-    : Pickle(MSG_HEADER_SZ_DATA, data, data_len) {
+Message::Message(const char* data, int data_len, uint32_t capacity)
+    : Pickle(MSG_HEADER_SZ_DATA, data, data_len, capacity) {
   MOZ_COUNT_CTOR(IPC::Message);
 }
 
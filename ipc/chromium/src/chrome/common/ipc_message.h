@@ -176,7 +176,10 @@ class Message : public Pickle {
           uint32_t segmentCapacity = 0,  // 0 for the default capacity.
           HeaderFlags flags = HeaderFlags(), bool recordWriteLatency = false);
 
-  Message(const char* data, int data_len);
+  // Initialize a message from the first |data_len| bytes of its serialized
+  // form; |capacity| may be the full size of the message, to reserve room for
+  // the rest of it.
+  Message(const char* data, int data_len, uint32_t capacity = 0);
 
   Message(const Message& other) = delete;
   Message(Message&& other);
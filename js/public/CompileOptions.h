@@ -119,6 +119,10 @@ class JS_PUBLIC_API TransitiveCompileOptions {
   bool forceAsync = false;
   bool discardSource = false;
   bool sourceIsLazy = false;
+  // If the source is lazy, still syntax-parse inner functions and let the
+  // embedding's SourceHook provide the source again when they are first
+  // called. Has no effect without sourceIsLazy.
+  bool lazilyParseLazySource = false;
   bool allowHTMLComments = true;
   bool hideScriptFromDebugger = false;
   bool bigIntEnabledOption = false;
@@ -416,6 +420,11 @@ class MOZ_STACK_CLASS JS_PUBLIC_API CompileOptions final
     return *this;
   }
 
+  CompileOptions& setLazilyParseLazySource(bool l) {
+    lazilyParseLazySource = l;
+    return *this;
+  }
+
   CompileOptions& setNonSyntacticScope(bool n) {
     nonSyntacticScope = n;
     return *this;
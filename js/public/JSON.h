@@ -15,6 +15,7 @@
 #include "jstypes.h"  // JS_PUBLIC_API
 
 #include "js/RootingAPI.h"  // JS::Handle, JS::MutableHandle
+#include "js/TypeDecls.h"    // JS::Latin1Char
 
 struct JSContext;
 class JSObject;
@@ -71,6 +72,17 @@ extern JS_PUBLIC_API bool JS_ParseJSON(JSContext* cx, const char16_t* chars,
                                        uint32_t len,
                                        JS::MutableHandle<JS::Value> vp);
 
+/**
+ * Performs the JSON.parse operation as specified by ECMAScript, on Latin-1
+ * text. Embeddings that receive ASCII-only JSON can parse it this way instead
+ * of inflating it to two-byte characters first; the strings in the result are
+ * then created as Latin-1 strings as well.
+ */
+extern JS_PUBLIC_API bool JS_ParseJSON(JSContext* cx,
+                                       const JS::Latin1Char* chars,
+                                       uint32_t len,
+                                       JS::MutableHandle<JS::Value> vp);
+
 /**
  * Performs the JSON.parse operation as specified by ECMAScript.
  */
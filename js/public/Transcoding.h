@@ -12,6 +12,7 @@
 #define js_Transcoding_h
 
 #include "mozilla/Range.h"   // mozilla::Range
+#include "mozilla/Span.h"    // mozilla::Span
 #include "mozilla/Vector.h"  // mozilla::Vector
 
 #include <stddef.h>  // size_t
@@ -40,6 +41,16 @@ struct TranscodeSource final {
 
 using TranscodeSources = mozilla::Vector<TranscodeSource>;
 
+// An XDR encoding of the self-hosted script, as produced by a previous call to
+// JS::InitSelfHostedCode with a SelfHostedWriter. Embeddings can produce it
+// once (for example in a parent process) and hand it to the other runtimes
+// they create so they can skip parsing and emitting the self-hosted builtins.
+using SelfHostedCache = mozilla::Span<const uint8_t>;
+
+// Callback receiving the XDR encoding of the self-hosted script after it has
+// been compiled from source. The buffer is only valid during the call.
+using SelfHostedWriter = bool (*)(JSContext*, SelfHostedCache);
+
 enum TranscodeResult : uint8_t {
   // Successful encoding / decoding.
   TranscodeResult_Ok = 0,
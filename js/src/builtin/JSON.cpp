@@ -10,6 +10,9 @@
 #include "mozilla/FloatingPoint.h"
 #include "mozilla/Range.h"
 #include "mozilla/ScopeExit.h"
+#include "mozilla/TypeTraits.h"
+
+#include <algorithm>
 
 #include "jsnum.h"
 #include "jstypes.h"
@@ -36,6 +39,7 @@ using namespace js;
 
 using mozilla::CheckedInt;
 using mozilla::IsFinite;
+using mozilla::IsSame;
 using mozilla::Maybe;
 using mozilla::RangedPtr;
 
@@ -80,6 +84,21 @@ static MOZ_ALWAYS_INLINE RangedPtr<DstCharT> InfallibleQuote(
 
   /* Step 2. */
   while (srcBegin != srcEnd) {
+    // Latin-1 text has no surrogates, so everything up to the next character
+    // in need of escaping can be copied in bulk.
+    if (IsSame<SrcCharT, Latin1Char>::value) {
+      const SrcCharT* run = srcBegin.get();
+      size_t n = SkipPlainJSONStringChars(run, srcEnd.get()) - run;
+      if (n) {
+        std::copy(run, run + n, dstPtr.get());
+        srcBegin += n;
+        dstPtr += n;
+        if (srcBegin == srcEnd) {
+          break;
+        }
+      }
+    }
+
     const SrcCharT c = *srcBegin++;
 
     // Handle the Latin-1 cases.
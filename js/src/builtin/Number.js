@@ -33,6 +33,19 @@ function Number_toLocaleString() {
             numberFormatCache.runtimeDefaultLocale = RuntimeDefaultLocale();
         }
         numberFormat = numberFormatCache.numberFormat;
+    } else if (typeof locales === "string" && options === undefined) {
+        // Also cache the most recently used formatter for a single locale
+        // string without options, e.g. |x.toLocaleString("en-US")|. Locale
+        // negotiation can fall back to the default locale, so that has to
+        // match as well.
+        if (numberFormatCache.locale !== locales ||
+            !IsRuntimeDefaultLocale(numberFormatCache.localeDefault))
+        {
+            numberFormatCache.localeFormat = intl_NumberFormat(locales, options);
+            numberFormatCache.locale = locales;
+            numberFormatCache.localeDefault = RuntimeDefaultLocale();
+        }
+        numberFormat = numberFormatCache.localeFormat;
     } else {
         numberFormat = intl_NumberFormat(locales, options);
     }
@@ -10,6 +10,7 @@
 #include "mozilla/Attributes.h"
 #include "mozilla/CheckedInt.h"
 #include "mozilla/FloatingPoint.h"
+#include "mozilla/MathAlgorithms.h"
 #include "mozilla/PodOperations.h"
 #include "mozilla/Range.h"
 #include "mozilla/TextUtils.h"
@@ -18,6 +19,11 @@
 
 #include <limits>
 #include <string.h>
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define JS_STRING_MATCH_SSE2
+#  include <emmintrin.h>
+#endif
 
 #include "jsapi.h"
 #include "jsnum.h"
@@ -1830,6 +1836,31 @@ static const char* FirstCharMatcher8bit(const char* text, uint32_t n,
   return reinterpret_cast<const char*>(memchr(text, pat, n));
 }
 
+static const char16_t* FirstCharMatcher16bit(const char16_t* text, uint32_t n,
+                                             const char16_t pat) {
+#ifdef JS_STRING_MATCH_SSE2
+  // Compare eight code units at a time and leave the tail to the unrolled
+  // loop, so that long two-byte texts get close to memchr speed.
+  const char16_t* t = text;
+  const char16_t* const textend = text + n;
+  const __m128i needle = _mm_set1_epi16(int16_t(pat));
+  while (textend - t >= 8) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(t));
+    int mask = _mm_movemask_epi8(_mm_cmpeq_epi16(chunk, needle));
+    if (mask) {
+      return t + mozilla::CountTrailingZeroes32(uint32_t(mask)) / 2;
+    }
+    t += 8;
+  }
+  if (t == textend) {
+    return nullptr;
+  }
+  return FirstCharMatcherUnrolled(t, uint32_t(textend - t), pat);
+#else
+  return FirstCharMatcherUnrolled(text, n, pat);
+#endif
+}
+
 template <class InnerMatch, typename TextChar, typename PatChar>
 static int Matcher(const TextChar* text, uint32_t textlen, const PatChar* pat,
                    uint32_t patlen) {
@@ -1851,7 +1882,8 @@ static int Matcher(const TextChar* text, uint32_t textlen, const PatChar* pat,
       MOZ_ASSERT(pat[0] <= 0xff);
       pos = (TextChar*)FirstCharMatcher8bit((char*)text + i, n - i, pat[0]);
     } else {
-      pos = FirstCharMatcherUnrolled(text + i, n - i, char16_t(pat[0]));
+      pos = (TextChar*)FirstCharMatcher16bit((const char16_t*)text + i, n - i,
+                                             char16_t(pat[0]));
     }
 
     if (pos == nullptr) {
@@ -2217,6 +2249,17 @@ bool js::str_includes(JSContext* cx, unsigned argc, Value* vp) {
   uint32_t start = Min(Max(pos, 0U), textLen);
 
   // Steps 9-10.
+  if (start == 0 && str->isRope()) {
+    // Search the rope's leaves in place rather than flattening it for a
+    // single scan.
+    int match;
+    if (!RopeMatch(cx, &str->asRope(), searchStr, &match)) {
+      return false;
+    }
+    args.rval().setBoolean(match != -1);
+    return true;
+  }
+
   JSLinearString* text = str->ensureLinear(cx);
   if (!text) {
     return false;
@@ -2271,6 +2314,16 @@ bool js::str_indexOf(JSContext* cx, unsigned argc, Value* vp) {
   }
 
   // Steps 10 and 11
+  if (start == 0 && str->isRope()) {
+    // As in str_includes, avoid flattening for a one-shot search.
+    int match;
+    if (!RopeMatch(cx, &str->asRope(), searchStr, &match)) {
+      return false;
+    }
+    args.rval().setInt32(match);
+    return true;
+  }
+
   JSLinearString* text = str->ensureLinear(cx);
   if (!text) {
     return false;
@@ -403,7 +403,8 @@ bool BytecodeCompiler::createScriptSource(
 
 bool BytecodeCompiler::canLazilyParse() const {
   return options.canLazilyParse && !options.discardSource &&
-         !options.sourceIsLazy && !options.forceFullParse();
+         (!options.sourceIsLazy || options.lazilyParseLazySource) &&
+         !options.forceFullParse();
 }
 
 template <typename Unit>
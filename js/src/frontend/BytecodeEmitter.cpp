@@ -19,6 +19,7 @@
 #include "mozilla/Unused.h"         // mozilla::Unused
 #include "mozilla/Variant.h"        // mozilla::AsVariant
 
+#include <algorithm>  // std::min
 #include <string.h>
 
 #include "jsnum.h"    // NumberToAtom
@@ -143,7 +144,36 @@ void BytecodeEmitter::initFromBodyPosition(TokenPos bodyPosition) {
   setFunctionBodyEndPos(bodyPosition.end);
 }
 
-bool BytecodeEmitter::init() { return perScriptData_.init(cx); }
+// When the extent of the function body is known up front, reserve bytecode
+// and source note space in proportion to it so that large functions don't go
+// through a long series of vector reallocations while emitting. The body's
+// source also contains any inner functions, which are emitted separately, so
+// keep the estimate conservative and cap it.
+static constexpr size_t SourceUnitsPerBytecodeReserve = 2;
+static constexpr size_t BytecodePerSrcNotesReserve = 4;
+static constexpr size_t MaxBytecodeReserve = 64 * 1024;
+
+bool BytecodeEmitter::init() {
+  if (!perScriptData_.init(cx)) {
+    return false;
+  }
+
+  if (scriptStartOffset.isSome() && functionBodyEndPos.isSome() &&
+      *functionBodyEndPos > *scriptStartOffset) {
+    size_t sourceLength = *functionBodyEndPos - *scriptStartOffset;
+    size_t codeReserve = std::min(sourceLength / SourceUnitsPerBytecodeReserve,
+                                  MaxBytecodeReserve);
+    if (!bytecodeSection().code().reserve(codeReserve)) {
+      return false;
+    }
+    if (!bytecodeSection().notes().reserve(codeReserve /
+                                           BytecodePerSrcNotesReserve)) {
+      return false;
+    }
+  }
+
+  return true;
+}
 
 template <typename T>
 T* BytecodeEmitter::findInnermostNestableControl() const {
@@ -2914,6 +2914,17 @@ void GCRuntime::updateCellPointers(Zone* zone, AllocKinds kinds,
 
   fgTask->runFromMainThread(rt);
 
+  // Rather than blocking while the background tasks finish, help them with
+  // any arenas they have not yet claimed.
+  if (tasksStarted) {
+    Maybe<UpdatePointersTask> helperTask;
+    {
+      AutoLockHelperThreadState lock;
+      helperTask.emplace(rt, &bgArenas, lock);
+    }
+    helperTask->runFromMainThread(rt);
+  }
+
   {
     AutoLockHelperThreadState lock;
 
@@ -6196,7 +6207,63 @@ void GCRuntime::startSweepingAtomsTable() {
   }
 
   // Initialize remaining atoms to sweep.
-  maybeAtoms.emplace(*atomsTable);
+  maybeAtoms.emplace();
+}
+
+// Sweep atoms table partitions on a helper thread until there are none left or
+// the slice budget is used up.
+class IncrementalSweepAtomsTask
+    : public GCParallelTaskHelper<IncrementalSweepAtomsTask> {
+  AtomsTable& atoms_;
+  AtomsTable::SweepIterator& work_;
+  SliceBudget& budget_;
+  AutoLockHelperThreadState& lock_;
+  size_t partition_;
+
+  // The number of atoms to sweep between budget checks, which require the
+  // helper thread lock.
+  static const size_t StepsPerBudgetCheck = 256;
+
+ public:
+  IncrementalSweepAtomsTask(JSRuntime* rt, AtomsTable& atoms,
+                            AtomsTable::SweepIterator& work, size_t partition,
+                            SliceBudget& budget,
+                            AutoLockHelperThreadState& lock)
+      : GCParallelTaskHelper(rt),
+        atoms_(atoms),
+        work_(work),
+        budget_(budget),
+        lock_(lock),
+        partition_(partition) {
+    runtime()->gc.startTask(*this, gcstats::PhaseKind::SWEEP_ATOMS_TABLE,
+                            lock_);
+  }
+
+  ~IncrementalSweepAtomsTask() {
+    runtime()->gc.joinTask(*this, gcstats::PhaseKind::SWEEP_ATOMS_TABLE,
+                           lock_);
+  }
+
+  void run() {
+    while (true) {
+      bool finished =
+          atoms_.sweepPartitionIncrementally(partition_, StepsPerBudgetCheck);
+
+      AutoLockHelperThreadState lock;
+      budget_.step(StepsPerBudgetCheck);
+      work_.release(partition_, finished, lock);
+      if (budget_.isOverBudget() || !work_.claim(&partition_, lock)) {
+        return;
+      }
+    }
+  }
+};
+
+static const size_t MaxAtomsSweepTasks = 8;
+
+static size_t AtomsSweepTaskCount() {
+  size_t targetTaskCount = HelperThreadState().cpuCount;
+  return Min(targetTaskCount, MaxAtomsSweepTasks);
 }
 
 IncrementalProgress GCRuntime::sweepAtomsTable(FreeOp* fop,
@@ -6205,15 +6272,33 @@ IncrementalProgress GCRuntime::sweepAtomsTable(FreeOp* fop,
     return Finished;
   }
 
-  gcstats::AutoPhase ap(stats(), gcstats::PhaseKind::SWEEP_ATOMS_TABLE);
-
   auto& maybeAtoms = maybeAtomsToSweep.ref();
   if (!maybeAtoms) {
     return Finished;
   }
 
-  if (!rt->atomsForSweeping()->sweepIncrementally(maybeAtoms.ref(), budget)) {
-    return NotFinished;
+  AtomsTable* atomsTable = rt->atomsForSweeping();
+  AtomsTable::SweepIterator& work = maybeAtoms.ref();
+
+  {
+    // Each partition is independent, so sweep several of them at once. The
+    // tasks record their time under SWEEP_ATOMS_TABLE themselves.
+    AutoLockHelperThreadState lock;
+    Maybe<IncrementalSweepAtomsTask> tasks[MaxAtomsSweepTasks];
+    size_t partition;
+    for (size_t i = 0;
+         i < AtomsSweepTaskCount() && work.claim(&partition, lock); i++) {
+      tasks[i].emplace(rt, *atomsTable, work, partition, budget, lock);
+    }
+
+    // Tasks run until budget or work is exhausted.
+  }
+
+  {
+    AutoLockHelperThreadState lock;
+    if (!work.empty(lock)) {
+      return NotFinished;
+    }
   }
 
   maybeAtoms.reset();
@@ -213,6 +213,28 @@ struct TenureCountCache {
   TenureCount& findEntry(ObjectGroup* group) {
     return entries[hash(group) % EntryCount];
   }
+
+  // Count one tenured object of |group|. If the primary entry is already
+  // taken by another group, try the neighbouring entry too so that two hot
+  // allocation sites that collide can both be tracked.
+  void noteTenured(ObjectGroup* group) {
+    size_t index = hash(group) % EntryCount;
+    for (size_t probe = 0; probe < MaxProbes; probe++) {
+      TenureCount& entry = entries[(index + probe) % EntryCount];
+      if (entry.group == group) {
+        entry.count++;
+        return;
+      }
+      if (!entry.group) {
+        entry.group = group;
+        entry.count = 1;
+        return;
+      }
+    }
+  }
+
+ private:
+  static const size_t MaxProbes = 2;
 };
 
 struct MOZ_RAII AutoAssertNoNurseryAlloc {
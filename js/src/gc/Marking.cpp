@@ -3241,13 +3241,7 @@ void js::Nursery::collectToFixedPoint(TenuringTracer& mover,
     JSObject* obj = static_cast<JSObject*>(p->forwardingAddress());
     mover.traceObject(obj);
 
-    TenureCount& entry = tenureCounts.findEntry(obj->groupRaw());
-    if (entry.group == obj->groupRaw()) {
-      entry.count++;
-    } else if (!entry.group) {
-      entry.group = obj->groupRaw();
-      entry.count = 1;
-    }
+    tenureCounts.noteTenured(obj->groupRaw());
   }
 
   for (RelocationOverlay* p = mover.stringHead; p; p = p->next()) {
@@ -682,6 +682,11 @@ void js::Nursery::renderProfileJSON(JSONPrinter& json) const {
     json.property("groups_pretenured",
                   stats().getStat(gcstats::STAT_OBJECT_GROUPS_PRETENURED));
   }
+  if (stats().getStat(gcstats::STAT_OBJECT_GROUPS_PRETENURE_CANDIDATES)) {
+    json.property(
+        "groups_pretenure_candidates",
+        stats().getStat(gcstats::STAT_OBJECT_GROUPS_PRETENURE_CANDIDATES));
+  }
   if (stats().getStat(gcstats::STAT_NURSERY_STRING_REALMS_DISABLED)) {
     json.property(
         "nursery_string_realms_disabled",
@@ -1032,9 +1037,18 @@ float js::Nursery::doPretenuring(JSRuntime* rt, JS::GCReason reason,
     pretenureStr = false;
   }
 
-  if (pretenureObj) {
+  uint32_t threshold = tunables().pretenureGroupThreshold();
+  uint32_t candidateCount = 0;
+  for (auto& entry : tenureCounts.entries) {
+    if (entry.count >= threshold) {
+      candidateCount++;
+    }
+  }
+  stats().setStat(gcstats::STAT_OBJECT_GROUPS_PRETENURE_CANDIDATES,
+                  candidateCount);
+
+  if (pretenureObj && candidateCount) {
     JSContext* cx = rt->mainContextFromOwnThread();
-    uint32_t threshold = tunables().pretenureGroupThreshold();
     for (auto& entry : tenureCounts.entries) {
       if (entry.count < threshold) {
         continue;
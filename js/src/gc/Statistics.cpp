@@ -433,6 +433,7 @@ UniqueChars Statistics::formatDetailedDescription() const {
   MinorGCs since last GC: %d\n\
   Store Buffer Overflows: %d\n\
   MMU 20ms:%.1f%%; 50ms:%.1f%%\n\
+  Mark Rate: %.0f cells/ms\n\
   SCC Sweep Total (MaxPause): %.3fms (%.3fms)\n\
   HeapSize: %.3f MiB\n\
   Chunk Delta (magnitude): %+d  (%d)\n\
@@ -456,7 +457,8 @@ UniqueChars Statistics::formatDetailedDescription() const {
       zoneStats.sweptZoneCount, zoneStats.collectedCompartmentCount,
       zoneStats.compartmentCount, zoneStats.sweptCompartmentCount,
       getCount(COUNT_MINOR_GC), getCount(COUNT_STOREBUFFER_OVERFLOW),
-      mmu20 * 100., mmu50 * 100., t(sccTotal), t(sccLongest),
+      mmu20 * 100., mmu50 * 100., computeMarkRate(), t(sccTotal),
+      t(sccLongest),
       double(preHeapSize) / bytesPerMiB,
       getCount(COUNT_NEW_CHUNK) - getCount(COUNT_DESTROY_CHUNK),
       getCount(COUNT_NEW_CHUNK) + getCount(COUNT_DESTROY_CHUNK),
@@ -687,6 +689,7 @@ void Statistics::formatJsonDescription(uint64_t timestamp, JSONPrinter& json,
   json.property("allocated_bytes", preHeapSize);  // #17
   if (use == Statistics::JSONUse::PROFILER) {
     json.property("post_heap_size", postHeapSize);
+    json.floatProperty("mark_rate", computeMarkRate(), 0);
   }
 
   uint32_t addedChunks = getCount(COUNT_NEW_CHUNK);
@@ -1004,11 +1007,8 @@ void Statistics::endGC() {
                         !zoneStats.isFullCollection());
   TimeDuration markTotal = SumPhase(PhaseKind::MARK, phaseTimes);
   TimeDuration markRootsTotal = SumPhase(PhaseKind::MARK_ROOTS, phaseTimes);
-  double markTime = t(markTotal);
-  size_t markCount = runtime->gc.marker.getMarkCount();
-  double markRate = markCount / markTime;
-  runtime->addTelemetry(JS_TELEMETRY_GC_MARK_MS, markTime);
-  runtime->addTelemetry(JS_TELEMETRY_GC_MARK_RATE, markRate);
+  runtime->addTelemetry(JS_TELEMETRY_GC_MARK_MS, t(markTotal));
+  runtime->addTelemetry(JS_TELEMETRY_GC_MARK_RATE, computeMarkRate());
   runtime->addTelemetry(JS_TELEMETRY_GC_SWEEP_MS, t(phaseTimes[Phase::SWEEP]));
   if (runtime->gc.isCompactingGc()) {
     runtime->addTelemetry(JS_TELEMETRY_GC_COMPACT_MS,
@@ -1444,6 +1444,14 @@ void Statistics::endSCC(unsigned scc, TimeStamp start) {
   sccTimes[scc] += ReallyNow() - start;
 }
 
+double Statistics::computeMarkRate() const {
+  double markTime = t(SumPhase(PhaseKind::MARK, phaseTimes));
+  if (markTime == 0.0) {
+    return 0.0;
+  }
+  return runtime->gc.marker.getMarkCount() / markTime;
+}
+
 /*
  * MMU (minimum mutator utilization) is a measure of how much garbage collection
  * is affecting the responsiveness of the system. MMU measurements are given
@@ -56,6 +56,10 @@ enum Stat {
   // Number of object types pretenured this minor GC.
   STAT_OBJECT_GROUPS_PRETENURED,
 
+  // Number of object groups whose tenure count reached the pretenuring
+  // threshold this minor GC, whether or not they were pretenured.
+  STAT_OBJECT_GROUPS_PRETENURE_CANDIDATES,
+
   // Number of realms that had nursery strings disabled due to large numbers
   // being tenured.
   STAT_NURSERY_STRING_REALMS_DISABLED,
@@ -452,6 +456,10 @@ struct Statistics {
 
   double computeMMU(TimeDuration resolution) const;
 
+  // Number of cells visited by the marker per millisecond of MARK phase time
+  // over the whole GC, or zero if no marking time was recorded.
+  double computeMarkRate() const;
+
   void printSliceProfile();
   static void printProfileTimes(const ProfileDurations& times);
 };
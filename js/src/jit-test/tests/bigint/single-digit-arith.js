@@ -0,0 +1,69 @@
+// BigInt add, sub and mul have fast paths for single-digit operands. Cover
+// every sign combination, results that cross or land on zero, and results
+// that carry out of a single 32-bit or 64-bit digit.
+
+const D32 = 0xffffffffn;
+const D64 = 0xffffffffffffffffn;
+
+// [x, y, x + y, x - y, x * y]
+const cases = [
+    [5n, 3n, 8n, 2n, 15n],
+    [-5n, 3n, -2n, -8n, -15n],
+    [5n, -3n, 2n, 8n, -15n],
+    [-5n, -3n, -8n, -2n, 15n],
+    [3n, 5n, 8n, -2n, 15n],
+    [-3n, 5n, 2n, -8n, -15n],
+    [3n, -5n, -2n, 8n, -15n],
+    [-3n, -5n, -8n, 2n, 15n],
+
+    [5n, 5n, 10n, 0n, 25n],
+    [-5n, -5n, -10n, 0n, 25n],
+    [5n, -5n, 0n, 10n, -25n],
+    [-5n, 5n, 0n, -10n, -25n],
+
+    [D32, 1n, 0x100000000n, 0xfffffffen, D32],
+    [-D32, -1n, -0x100000000n, -0xfffffffen, D32],
+    [D32, D32, 0x1fffffffen, 0n, 0xfffffffe00000001n],
+    [D32, -D32, 0n, 0x1fffffffen, -0xfffffffe00000001n],
+    [1n, D32, 0x100000000n, -0xfffffffen, D32],
+
+    [D64, 1n, 0x10000000000000000n, 0xfffffffffffffffen, D64],
+    [-D64, -1n, -0x10000000000000000n, -0xfffffffffffffffen, D64],
+    [-D64, 1n, -0xfffffffffffffffen, -0x10000000000000000n, -D64],
+    [1n, D64, 0x10000000000000000n, -0xfffffffffffffffen, D64],
+    [D64, D64, 0x1fffffffffffffffen, 0n,
+     0xfffffffffffffffe0000000000000001n],
+    [D64, -D64, 0n, 0x1fffffffffffffffen,
+     -0xfffffffffffffffe0000000000000001n],
+    [-D64, -D64, -0x1fffffffffffffffen, 0n,
+     0xfffffffffffffffe0000000000000001n],
+    [D64, 2n, 0x10000000000000001n, 0xfffffffffffffffdn,
+     0x1fffffffffffffffen],
+    [-D64, 2n, -0xfffffffffffffffdn, -0x10000000000000001n,
+     -0x1fffffffffffffffen],
+];
+
+function add(x, y) { return x + y; }
+function sub(x, y) { return x - y; }
+function mul(x, y) { return x * y; }
+
+function check(actual, expected) {
+    assertEq(actual, expected);
+    // A zero result must not keep a sign.
+    assertEq(String(actual), String(expected));
+}
+
+for (let i = 0; i < 100; i++) {
+    for (let [x, y, sum, diff, prod] of cases) {
+        check(add(x, y), sum);
+        check(add(y, x), sum);
+        check(sub(x, y), diff);
+        check(sub(y, x), -diff);
+        check(mul(x, y), prod);
+        check(mul(y, x), prod);
+    }
+}
+
+assertEq(String(-(5n - 5n)), "0");
+assertEq(String(-5n + 5n), "0");
+assertEq(String(-5n * 0n), "0");
@@ -0,0 +1,142 @@
+// The megamorphic GetProp/GetElem stubs look properties up through a
+// runtime-wide cache keyed on the receiver's shape. Check that none of the
+// ways a cached lookup can go stale are missed.
+
+// Returns |count| objects with distinct shapes, all with prototype |proto|.
+function makeObjects(proto, count) {
+    let objs = [];
+    for (let i = 0; i < count; i++) {
+        let o = Object.create(proto);
+        o["p" + i] = i;
+        objs.push(o);
+    }
+    return objs;
+}
+
+function getX(o) { return o.x; }
+function getElem(o, id) { return o[id]; }
+
+function testPrototypeMutated() {
+    let grandProto = {x: "grand"};
+    let proto = Object.create(grandProto);
+    let objs = makeObjects(proto, 30);
+
+    for (let i = 0; i < 100; i++) {
+        for (let o of objs) {
+            assertEq(getX(o), "grand");
+        }
+    }
+
+    // Shadow it on the prototype.
+    proto.x = "proto";
+    for (let o of objs) {
+        assertEq(getX(o), "proto");
+    }
+
+    // Remove it again, and change the value on the grand prototype.
+    delete proto.x;
+    grandProto.x = "grand2";
+    for (let o of objs) {
+        assertEq(getX(o), "grand2");
+    }
+
+    // Change the prototype itself.
+    Object.setPrototypeOf(proto, {x: "other"});
+    for (let o of objs) {
+        assertEq(getX(o), "other");
+    }
+}
+testPrototypeMutated();
+
+function testShadowedOnReceiver() {
+    let proto = {x: "proto"};
+    let objs = makeObjects(proto, 30);
+
+    for (let i = 0; i < 100; i++) {
+        for (let o of objs) {
+            assertEq(getX(o), "proto");
+        }
+    }
+
+    for (let i = 0; i < objs.length; i += 2) {
+        objs[i].x = "own" + i;
+    }
+    for (let i = 0; i < objs.length; i++) {
+        assertEq(getX(objs[i]), i % 2 ? "proto" : "own" + i);
+    }
+}
+testShadowedOnReceiver();
+
+function testResolveHooks() {
+    // The global resolves standard classes lazily, and String objects
+    // resolve their indexed characters.
+    let objs = makeObjects(this, 30);
+    let names = ["Float64Array", "WeakSet", "DataView", "Uint8ClampedArray"];
+    for (let i = 0; i < 100; i++) {
+        for (let o of objs) {
+            assertEq(getElem(o, names[i % names.length]),
+                     this[names[i % names.length]]);
+        }
+    }
+
+    let strs = [];
+    for (let i = 0; i < 30; i++) {
+        let s = new String("abcdef");
+        s["p" + i] = i;
+        strs.push(s);
+    }
+    for (let i = 0; i < 100; i++) {
+        for (let s of strs) {
+            assertEq(getElem(s, "length"), 6);
+            assertEq(getElem(s, String(i % 6)), "abcdef"[i % 6]);
+        }
+    }
+}
+testResolveHooks.call(this);
+
+function testMissingThenPresent() {
+    let grandProto = {};
+    let proto = Object.create(grandProto);
+    let objs = makeObjects(proto, 30);
+
+    for (let i = 0; i < 100; i++) {
+        for (let o of objs) {
+            assertEq(getX(o), undefined);
+        }
+    }
+
+    grandProto.x = "grand";
+    for (let o of objs) {
+        assertEq(getX(o), "grand");
+    }
+
+    delete grandProto.x;
+    for (let o of objs) {
+        assertEq(getX(o), undefined);
+    }
+
+    Object.prototype.x = "object";
+    try {
+        for (let o of objs) {
+            assertEq(getX(o), "object");
+        }
+    } finally {
+        delete Object.prototype.x;
+    }
+}
+testMissingThenPresent();
+
+// Entries hold shape pointers, so make sure lookups still work across GCs.
+function testAcrossGC() {
+    let proto = {x: 1};
+    let objs = makeObjects(proto, 30);
+    for (let i = 0; i < 20; i++) {
+        for (let o of objs) {
+            assertEq(getX(o), 1);
+        }
+        if (i % 5 == 0) {
+            gc();
+        }
+    }
+}
+testAcrossGC();
@@ -0,0 +1,49 @@
+// Ion specializes the self-hosted Array.prototype.map/filter/forEach/reduce
+// for each call site that passes a known callback. Give each site its own
+// callback, and check that results stay right when a site's callback changes
+// or throws after compilation.
+
+function double(arr) { return arr.map(x => x * 2); }
+function odd(arr) { return arr.filter(x => x & 1); }
+function sum(arr) { return arr.reduce((a, x) => a + x, 0); }
+function count(arr) {
+    let n = 0;
+    arr.forEach(() => { n++; });
+    return n;
+}
+function apply(arr, f) { return arr.map(f); }
+
+let arr = [1, 2, 3, 4, 5];
+for (let i = 0; i < 2000; i++) {
+    assertEq(double(arr).join(), "2,4,6,8,10");
+    assertEq(odd(arr).join(), "1,3,5");
+    assertEq(sum(arr), 15);
+    assertEq(count(arr), 5);
+    assertEq(apply(arr, x => x + 1).join(), "2,3,4,5,6");
+}
+
+// A site that was specialized for one callback sees another one.
+assertEq(apply(arr, x => String(x)).join(), "1,2,3,4,5");
+assertEq(apply(arr, Math.abs).join(), "1,2,3,4,5");
+
+// Sparse arrays skip holes, also once specialized.
+let sparse = [1, , 3];
+for (let i = 0; i < 2000; i++) {
+    assertEq(count(sparse), 2);
+    assertEq(double(sparse).length, 3);
+    assertEq(1 in double(sparse), false);
+}
+
+// A callback that throws leaves the builtin through the exception.
+function mapThrowing(arr, limit) {
+    return arr.map(x => {
+        if (x > limit)
+            throw new RangeError("too big");
+        return x;
+    });
+}
+for (let i = 0; i < 2000; i++) {
+    assertEq(mapThrowing(arr, 10).length, 5);
+}
+assertThrowsInstanceOf(() => mapThrowing(arr, 3), RangeError);
+assertThrowsInstanceOf(() => apply(arr, null), TypeError);
@@ -0,0 +1,79 @@
+// JSON string scanning handles sixteen bytes at a time where SIMD is
+// available. Put each character that ends a run of plain characters at every
+// position of strings around the chunk sizes, for both Latin-1 and two-byte
+// input, and check JSON.parse and JSON.stringify against the expected result.
+
+const lengths = [1, 7, 8, 9, 15, 16, 17, 31, 32, 33, 47, 48, 49];
+
+// Two-byte characters whose low byte is '"', '\\' or a control character,
+// none of which are special.
+const twoByteFillers = ["\u2222", "\u015c", "\u010a", "\u0100"];
+
+function filler(twoByte, i) {
+    if (twoByte) {
+        return twoByteFillers[i % twoByteFillers.length];
+    }
+    return "abcdefgh"[i % 8];
+}
+
+function makeString(twoByte, length, pos, ch) {
+    let s = "";
+    for (let i = 0; i < length; i++) {
+        s += i === pos ? ch : filler(twoByte, i);
+    }
+    return s;
+}
+
+function quote(s) {
+    let r = '"';
+    for (let c of s) {
+        let code = c.charCodeAt(0);
+        if (c === '"' || c === '\\') {
+            r += '\\' + c;
+        } else if (code < 0x20) {
+            let named = {8: "b", 9: "t", 10: "n", 12: "f", 13: "r"}[code];
+            r += named ? "\\" + named
+                       : "\\u00" + (code < 0x10 ? "0" : "") + code.toString(16);
+        } else {
+            r += c;
+        }
+    }
+    return r + '"';
+}
+
+for (let twoByte of [false, true]) {
+    for (let length of lengths) {
+        // No special characters at all.
+        let plain = makeString(twoByte, length, -1, "");
+        assertEq(JSON.parse('"' + plain + '"'), plain);
+        assertEq(JSON.stringify(plain), '"' + plain + '"');
+
+        for (let pos = 0; pos < length; pos++) {
+            for (let ch of ['"', '\\', '\n', '\x00', '\x1f']) {
+                let s = makeString(twoByte, length, pos, ch);
+
+                // Stringify escapes the character wherever it falls.
+                let quoted = JSON.stringify(s);
+                assertEq(quoted, quote(s));
+
+                // Parsing the escaped form gives the string back.
+                assertEq(JSON.parse(quoted), s);
+
+                // An unescaped control character is a syntax error, and an
+                // unescaped quote ends the string early.
+                if (ch !== '\\') {
+                    assertThrowsInstanceOf(() => JSON.parse('"' + s + '"'),
+                                           SyntaxError);
+                }
+            }
+
+            // A character just above the control range is plain.
+            let s = makeString(twoByte, length, pos, " ");
+            assertEq(JSON.parse('"' + s + '"'), s);
+            assertEq(JSON.stringify(s), '"' + s + '"');
+        }
+
+        // A string that is unterminated right at a chunk boundary.
+        assertThrowsInstanceOf(() => JSON.parse('"' + plain), SyntaxError);
+    }
+}
@@ -0,0 +1,76 @@
+// Regexps start out interpreted and are compiled to native code once they
+// are hot or run on a long input. Check that results don't change across the
+// tier-up, for captures, lastIndex and the global and sticky flags, on both
+// Latin-1 and two-byte input.
+
+const ITERATIONS = 50;
+
+function describe(re, str) {
+    let result = [];
+    re.lastIndex = 0;
+    if (re.global || re.sticky) {
+        let m;
+        while ((m = re.exec(str)) !== null) {
+            result.push([m.index, ...m, re.lastIndex].join(","));
+            if (m[0] === "") {
+                re.lastIndex++;
+            }
+        }
+        result.push("end:" + re.lastIndex);
+    } else {
+        let m = re.exec(str);
+        result.push(m === null ? "null" : [m.index, ...m].join(","));
+    }
+    return result.join(";");
+}
+
+function testTierUp(source, flags, str, expected) {
+    // Use a fresh regexp so that it starts out interpreted.
+    let re = new RegExp(source, flags);
+    for (let i = 0; i < ITERATIONS; i++) {
+        assertEq(describe(re, str), expected);
+    }
+}
+
+testTierUp("(\\d+)-(\\d+)", "", "ab 12-345 cd", "3,12-345,12,345");
+testTierUp("(a)|(b)", "g", "xaby", "1,a,a,,2;2,b,,b,3;end:0");
+testTierUp("a(b)?", "y", "aabab", "0,a,,1;1,ab,b,3;3,ab,b,5;end:0");
+testTierUp("x*", "g", "axxb", "0,,0;1,xx,3;3,,3;4,,4;end:0");
+testTierUp("(\\u00e9+)", "gi", "éÉaé",
+           "0,éÉ,éÉ,2;3,é,é,4;end:0");
+testTierUp("(\\u2222)(.)", "g", "a∢b∢c",
+           "1,∢b,∢,b,3;3,∢c,∢,c,5;end:0");
+testTierUp("(.)", "gu", "😀a",
+           "0,😀,😀,2;2,a,a,3;end:0");
+testTierUp("nomatch", "g", "haystack", "end:0");
+
+// The same regexp alternating between Latin-1 and two-byte input, which
+// tier up separately.
+{
+    let re = /(b+)(c)?/g;
+    for (let i = 0; i < ITERATIONS; i++) {
+        assertEq(describe(re, "abbcb"), "1,bbc,bb,c,4;4,b,b,,5;end:0");
+        assertEq(describe(re, "∢bbcb"), "1,bbc,bb,c,4;4,b,b,,5;end:0");
+    }
+}
+
+// A long input tiers the regexp up on its first run.
+{
+    let long = "a".repeat(5000) + "xyz" + "b".repeat(5000);
+    let re = /(x)(y)(z)/g;
+    for (let i = 0; i < 3; i++) {
+        assertEq(describe(re, long), "5000,xyz,x,y,z,5003;end:0");
+        assertEq(describe(re, "xyz"), "0,xyz,x,y,z,3;end:0");
+    }
+}
+
+// Tiering up survives a shrinking GC discarding the native code.
+{
+    let re = /(o+)/g;
+    for (let i = 0; i < ITERATIONS; i++) {
+        assertEq(describe(re, "foo boo"), "1,oo,oo,3;5,oo,oo,7;end:0");
+        if (i % 10 == 0) {
+            gc(undefined, "shrinking");
+        }
+    }
+}
@@ -0,0 +1,66 @@
+// |jit-test| skip-if: !wasmBulkMemSupported(); test-also=--wasm-compiler=baseline; test-also=--wasm-compiler=ion
+
+// memory.copy and memory.init check their whole source and destination ranges
+// before writing, like memory.fill: an operation that would go out of bounds
+// traps and leaves memory untouched.
+
+const PAGESIZE = 65536;
+
+let ins = wasmEvalText(
+    `(module
+       (memory (export "mem") 1)
+       (data passive "\\01\\02\\03\\04\\05\\06\\07\\08")
+       (func (export "copy") (param $dst i32) (param $src i32) (param $len i32)
+         (memory.copy (local.get $dst) (local.get $src) (local.get $len)))
+       (func (export "init") (param $dst i32) (param $src i32) (param $len i32)
+         (memory.init 0 (local.get $dst) (local.get $src) (local.get $len))))`);
+let mem = new Uint8Array(ins.exports.mem.buffer);
+
+function reset() {
+    mem.fill(0);
+    for (let i = 0; i < 16; i++)
+        mem[i] = i + 1;
+}
+
+function checkUnchanged() {
+    for (let i = 0; i < 16; i++)
+        assertEq(mem[i], i + 1);
+    for (let i = PAGESIZE - 32; i < PAGESIZE; i++)
+        assertEq(mem[i], 0);
+}
+
+function checkTraps(f) {
+    reset();
+    assertErrorMessage(f, WebAssembly.RuntimeError, /index out of bounds/);
+    checkUnchanged();
+}
+
+// In bounds, including ending exactly at the end of memory.
+reset();
+ins.exports.copy(PAGESIZE - 16, 0, 16);
+for (let i = 0; i < 16; i++)
+    assertEq(mem[PAGESIZE - 16 + i], i + 1);
+reset();
+ins.exports.init(PAGESIZE - 8, 0, 8);
+for (let i = 0; i < 8; i++)
+    assertEq(mem[PAGESIZE - 8 + i], i + 1);
+
+// Destination one byte past the end: nothing is written, in either copy
+// direction.
+checkTraps(() => ins.exports.copy(PAGESIZE - 15, 0, 16));
+checkTraps(() => ins.exports.copy(PAGESIZE - 15, PAGESIZE - 20, 16));
+checkTraps(() => ins.exports.init(PAGESIZE - 7, 0, 8));
+
+// Source one byte past the end of memory or of the segment.
+checkTraps(() => ins.exports.copy(0, PAGESIZE - 15, 16));
+checkTraps(() => ins.exports.init(0, 1, 8));
+
+// Offsets whose sum overflows 32 bits.
+checkTraps(() => ins.exports.copy(0xFFFFFFF0, 0, 32));
+checkTraps(() => ins.exports.init(0xFFFFFFF0, 0, 8));
+
+// Zero-length operations may sit at the end, but not past it.
+ins.exports.copy(PAGESIZE, PAGESIZE, 0);
+ins.exports.init(PAGESIZE, 8, 0);
+checkTraps(() => ins.exports.copy(PAGESIZE + 1, 0, 0));
+checkTraps(() => ins.exports.init(0, 9, 0));
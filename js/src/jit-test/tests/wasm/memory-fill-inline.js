@@ -0,0 +1,58 @@
+// |jit-test| skip-if: !wasmBulkMemSupported(); test-also=--wasm-compiler=baseline; test-also=--wasm-compiler=ion
+
+// Both compilers expand memory.fill with a small constant length into byte
+// stores.  Check that each expanded length writes exactly the bytes it should,
+// and that a fill running past the end of memory traps before writing
+// anything.  Lengths 0 and 17 go through the instance call, for comparison.
+
+const PAGESIZE = 65536;
+const MAXLEN = 17;
+
+let funcs = '';
+for (let len = 0; len <= MAXLEN; len++) {
+    funcs += `(func (export "fill${len}") (param $p i32) (param $v i32)
+                (memory.fill (local.get $p) (local.get $v) (i32.const ${len})))
+              (func (export "fillPastEnd${len}") (param $v i32)
+                (memory.fill (i32.const ${PAGESIZE - len + 1}) (local.get $v)
+                             (i32.const ${len})))`;
+}
+let ins = wasmEvalText(`(module (memory (export "mem") 1) ${funcs})`);
+let mem = new Uint8Array(ins.exports.mem.buffer);
+
+function checkRange(lo, hi, start, len, val) {
+    for (let i = Math.max(lo, 0); i < Math.min(hi, PAGESIZE); i++)
+        assertEq(mem[i], i >= start && i < start + len ? val : 0);
+}
+
+for (let len = 0; len <= MAXLEN; len++) {
+    let fill = ins.exports["fill" + len];
+
+    // In the middle of memory.  Only the low byte of the value is stored.
+    mem.fill(0);
+    fill(100, 0x1AB);
+    checkRange(90, 130, 100, len, 0xAB);
+
+    // Ending exactly at the end of memory.
+    mem.fill(0);
+    fill(PAGESIZE - len, 0xCD);
+    checkRange(PAGESIZE - 40, PAGESIZE, PAGESIZE - len, len, 0xCD);
+
+    // Ending one byte past the end of memory: nothing is written.
+    if (len > 0) {
+        mem.fill(0);
+        assertErrorMessage(() => fill(PAGESIZE - len + 1, 0xEF),
+                           WebAssembly.RuntimeError, /index out of bounds/);
+        checkRange(PAGESIZE - 40, PAGESIZE, 0, 0, 0);
+
+        // The same with a constant start, which the baseline compiler keeps
+        // as an immediate.
+        assertErrorMessage(() => ins.exports["fillPastEnd" + len](0xEF),
+                           WebAssembly.RuntimeError, /index out of bounds/);
+        checkRange(PAGESIZE - 40, PAGESIZE, 0, 0, 0);
+    }
+}
+
+// A zero-length fill may start at the end of memory, but not past it.
+ins.exports.fill0(PAGESIZE, 1);
+assertErrorMessage(() => ins.exports.fill0(PAGESIZE + 1, 1),
+                   WebAssembly.RuntimeError, /index out of bounds/);
@@ -1138,11 +1138,11 @@ static void InitMacroAssemblerForICStub(StackMacroAssembler& masm) {
 }
 
 JitCode* ICStubCompiler::getStubCode() {
-  JitRealm* realm = cx->realm()->jitRealm();
+  JitZone* jitZone = cx->zone()->jitZone();
 
   // Check for existing cached stubcode.
   uint32_t stubKey = getKey();
-  JitCode* stubCode = realm->getStubCode(stubKey);
+  JitCode* stubCode = jitZone->getStubCode(stubKey);
   if (stubCode) {
     return stubCode;
   }
@@ -1162,7 +1162,7 @@ JitCode* ICStubCompiler::getStubCode() {
   }
 
   // Cache newly compiled stubcode.
-  if (!realm->putStubCode(cx, stubKey, newStubCode)) {
+  if (!jitZone->putStubCode(cx, stubKey, newStubCode)) {
     return nullptr;
   }
 
@@ -1057,14 +1057,22 @@ void jit::ToggleBaselineProfiling(JSContext* cx, bool enable) {
 
   jrt->baselineInterpreter().toggleProfilerInstrumentation(enable);
 
-  for (ZonesIter zone(cx->runtime(), SkipAtoms); !zone.done(); zone.next()) {
-    for (auto script = zone->cellIter<JSScript>(); !script.done();
-         script.next()) {
-      if (enable) {
+  // Creating profile strings can GC, so do it before patching any code.
+  if (enable) {
+    for (ZonesIter zone(cx->runtime(), SkipAtoms); !zone.done(); zone.next()) {
+      for (auto script = zone->cellIter<JSScript>(); !script.done();
+           script.next()) {
         if (JitScript* jitScript = script->jitScript()) {
           jitScript->ensureProfileString(cx, script);
         }
       }
+    }
+  }
+
+  AutoWritableJitCodeBatch batch(cx->runtime());
+  for (ZonesIter zone(cx->runtime(), SkipAtoms); !zone.done(); zone.next()) {
+    for (auto script = zone->cellIter<JSScript>(); !script.done();
+         script.next()) {
       if (!script->hasBaselineScript()) {
         continue;
       }
@@ -1076,6 +1084,7 @@ void jit::ToggleBaselineProfiling(JSContext* cx, bool enable) {
 
 #ifdef JS_TRACE_LOGGING
 void jit::ToggleBaselineTraceLoggerScripts(JSRuntime* runtime, bool enable) {
+  AutoWritableJitCodeBatch batch(runtime);
   for (ZonesIter zone(runtime, SkipAtoms); !zone.done(); zone.next()) {
     for (auto iter = zone->cellIter<JSScript>(); !iter.done(); iter.next()) {
       JSScript* script = iter;
@@ -1091,6 +1100,7 @@ void jit::ToggleBaselineTraceLoggerScripts(JSRuntime* runtime, bool enable) {
 }
 
 void jit::ToggleBaselineTraceLoggerEngine(JSRuntime* runtime, bool enable) {
+  AutoWritableJitCodeBatch batch(runtime);
   for (ZonesIter zone(runtime, SkipAtoms); !zone.done(); zone.next()) {
     for (auto iter = zone->cellIter<JSScript>(); !iter.done(); iter.next()) {
       JSScript* script = iter;
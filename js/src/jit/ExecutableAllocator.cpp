@@ -27,6 +27,9 @@
 
 #include "jit/ExecutableAllocator.h"
 
+#include <algorithm>
+
+#include "gc/Memory.h"
 #include "gc/Zone.h"
 #include "jit/JitRealm.h"
 #include "js/MemoryMetrics.h"
@@ -269,6 +272,80 @@ void ExecutableAllocator::reprotectPool(JSRuntime* rt, ExecutablePool* pool,
 }
 
 /* static */
+AutoWritableJitCodeBatch::AutoWritableJitCodeBatch(JSRuntime* rt) : rt_(rt) {
+  MOZ_ASSERT(CurrentThreadCanAccessRuntime(rt));
+  rt_->setJitCodeWriteBatch(this);
+}
+
+AutoWritableJitCodeBatch::~AutoWritableJitCodeBatch() {
+  makeAllExecutable();
+  rt_->setJitCodeWriteBatch(nullptr);
+}
+
+bool AutoWritableJitCodeBatch::makeWritable(void* addr, size_t size) {
+  size_t pageSize = gc::SystemPageSize();
+  uintptr_t start = uintptr_t(addr) & ~(pageSize - 1);
+  uintptr_t end = (uintptr_t(addr) + size + pageSize - 1) & ~(pageSize - 1);
+
+  // Reprotect each run of pages that are not writable yet with one call.
+  uintptr_t runStart = 0;
+  for (uintptr_t page = start; page <= end; page += pageSize) {
+    bool needsReprotect = page < end && !writablePages_.has(page);
+    if (needsReprotect) {
+      if (!writablePages_.put(page)) {
+        makeAllExecutable();
+        return false;
+      }
+      if (!runStart) {
+        runStart = page;
+      }
+      continue;
+    }
+    if (runStart) {
+      if (!ExecutableAllocator::makeWritable(reinterpret_cast<void*>(runStart),
+                                             page - runStart)) {
+        makeAllExecutable();
+        return false;
+      }
+      runStart = 0;
+    }
+  }
+
+  return true;
+}
+
+void AutoWritableJitCodeBatch::makeAllExecutable() {
+  if (writablePages_.empty()) {
+    return;
+  }
+
+  AutoEnterOOMUnsafeRegion oomUnsafe;
+  Vector<uintptr_t, 0, SystemAllocPolicy> pages;
+  if (!pages.reserve(writablePages_.count())) {
+    oomUnsafe.crash("AutoWritableJitCodeBatch::makeAllExecutable");
+  }
+  for (PageSet::Range r = writablePages_.all(); !r.empty(); r.popFront()) {
+    pages.infallibleAppend(r.front());
+  }
+  std::sort(pages.begin(), pages.end());
+
+  size_t pageSize = gc::SystemPageSize();
+  size_t i = 0;
+  while (i < pages.length()) {
+    size_t j = i + 1;
+    while (j < pages.length() && pages[j] == pages[j - 1] + pageSize) {
+      j++;
+    }
+    if (!ExecutableAllocator::makeExecutable(
+            reinterpret_cast<void*>(pages[i]), (j - i) * pageSize)) {
+      MOZ_CRASH();
+    }
+    i = j;
+  }
+
+  writablePages_.clear();
+}
+
 void ExecutableAllocator::poisonCode(JSRuntime* rt,
                                      JitPoisonRangeVector& ranges) {
   MOZ_ASSERT(CurrentThreadCanAccessRuntime(rt));
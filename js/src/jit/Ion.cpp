@@ -378,15 +378,11 @@ void JSContext::freeOsrTempData() {
   osrTempData_ = nullptr;
 }
 
-JitRealm::JitRealm() : stubCodes_(nullptr), stringsCanBeInNursery(false) {}
+JitRealm::JitRealm() : stringsCanBeInNursery(false) {}
 
-JitRealm::~JitRealm() { js_delete(stubCodes_); }
+JitRealm::~JitRealm() {}
 
 bool JitRealm::initialize(JSContext* cx, bool zoneHasNurseryStrings) {
-  stubCodes_ = cx->new_<ICStubCodeMap>(cx->zone());
-  if (!stubCodes_) {
-    return false;
-  }
   setStringsCanBeInNursery(zoneHasNurseryStrings);
 
   return true;
@@ -577,8 +573,6 @@ void JitRealm::sweep(JS::Realm* realm) {
   // Any outstanding compilations should have been cancelled by the GC.
   MOZ_ASSERT(!HasOffThreadIonCompile(realm));
 
-  stubCodes_->sweep();
-
   for (WeakHeapPtrJitCode& stub : stubs_) {
     if (stub && IsAboutToBeFinalized(&stub)) {
       stub.set(nullptr);
@@ -586,14 +580,13 @@ void JitRealm::sweep(JS::Realm* realm) {
   }
 }
 
-void JitZone::sweep() { baselineCacheIRStubCodes_.sweep(); }
+void JitZone::sweep() {
+  baselineCacheIRStubCodes_.sweep();
+  stubCodes_.sweep();
+}
 
 size_t JitRealm::sizeOfIncludingThis(mozilla::MallocSizeOf mallocSizeOf) const {
-  size_t n = mallocSizeOf(this);
-  if (stubCodes_) {
-    n += stubCodes_->shallowSizeOfIncludingThis(mallocSizeOf);
-  }
-  return n;
+  return mallocSizeOf(this);
 }
 
 void JitZone::addSizeOfIncludingThis(mozilla::MallocSizeOf mallocSizeOf,
@@ -604,6 +597,7 @@ void JitZone::addSizeOfIncludingThis(mozilla::MallocSizeOf mallocSizeOf,
   *jitZone +=
       baselineCacheIRStubCodes_.shallowSizeOfExcludingThis(mallocSizeOf);
   *jitZone += ionCacheIRStubInfoSet_.shallowSizeOfExcludingThis(mallocSizeOf);
+  *jitZone += stubCodes_.shallowSizeOfExcludingThis(mallocSizeOf);
 
   *baselineStubsOptimized +=
       optimizedStubSpace_.sizeOfExcludingThis(mallocSizeOf);
@@ -2843,8 +2837,13 @@ void jit::Invalidate(TypeZone& types, FreeOp* fop,
   }
 
   JSContext* cx = TlsContext.get();
-  for (JitActivationIterator iter(cx); !iter.done(); ++iter) {
-    InvalidateActivation(fop, iter, false);
+  {
+    // Invalidated frames often share code pages, so coalesce the protection
+    // changes for all the patches below.
+    AutoWritableJitCodeBatch batch(cx->runtime());
+    for (JitActivationIterator iter(cx); !iter.done(); ++iter) {
+      InvalidateActivation(fop, iter, false);
+    }
   }
 
   // Drop the references added above. If a script was never active, its
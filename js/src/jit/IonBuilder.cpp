@@ -4292,6 +4292,15 @@ MDefinition* IonBuilder::patchInlinedReturns(CallInfo& callInfo,
   return phi;
 }
 
+// The self-hosted Array.prototype methods that call their first argument for
+// each element.
+static bool IsArrayCallbackBuiltin(const JSAtomState& names, JSFunction* fun) {
+  return IsSelfHostedFunctionWithName(fun, names.ArrayForEach) ||
+         IsSelfHostedFunctionWithName(fun, names.ArrayMap) ||
+         IsSelfHostedFunctionWithName(fun, names.ArrayFilter) ||
+         IsSelfHostedFunctionWithName(fun, names.ArrayReduce);
+}
+
 IonBuilder::InliningDecision IonBuilder::makeInliningDecision(
     JSObject* targetArg, CallInfo& callInfo) {
   // When there is no target, inlining is impossible.
@@ -4326,6 +4335,19 @@ IonBuilder::InliningDecision IonBuilder::makeInliningDecision(
   // Heuristics!
   JSScript* targetScript = target->nonLazyScript();
 
+  // All callers of a self-hosted higher-order Array builtin share its script,
+  // so the callback call inside it is megamorphic in that script's type
+  // information. Once inlined, though, the builtin's arguments are the
+  // caller's definitions, so the callback call sees this call site's callback
+  // types. When those name a single function, inlining specializes the
+  // builtin for this call site and lets the callback be inlined too. Don't
+  // let the caller's size or the builtin's recorded inlining depth, which
+  // was learned from other callers' callbacks, veto that.
+  bool specializeForCallback =
+      isHighestOptimizationLevel() && callInfo.argc() > 0 &&
+      IsArrayCallbackBuiltin(runtime->names(), target) &&
+      getSingleCallTarget(callInfo.getArg(0)->resultTypeSet());
+
   // Callee must not be excessively large.
   // This heuristic also applies to the callsite as a whole.
   bool offThread = options.offThreadCompilationAvailable();
@@ -4378,17 +4400,24 @@ IonBuilder::InliningDecision IonBuilder::makeInliningDecision(
   // Cap the inlining depth.
 
   uint32_t maxInlineDepth;
-  if (JitOptions.isSmallFunction(targetScript)) {
+  bool smallFunction = JitOptions.isSmallFunction(targetScript);
+  if (smallFunction) {
     maxInlineDepth = optimizationInfo().smallFunctionMaxInlineDepth();
   } else {
     maxInlineDepth = optimizationInfo().maxInlineDepth();
+  }
 
-    // Caller must not be excessively large.
-    if (script()->length() >=
-        optimizationInfo().inliningMaxCallerBytecodeLength()) {
-      trackOptimizationOutcome(TrackedOutcome::CantInlineBigCaller);
-      return DontInline(targetScript, "Vetoed: caller excessively large");
-    }
+  // Specializing only pays off if there is depth left to inline the callback.
+  if (inliningDepth_ + 1 >= maxInlineDepth) {
+    specializeForCallback = false;
+  }
+
+  // Caller must not be excessively large.
+  if (!smallFunction && !specializeForCallback &&
+      script()->length() >=
+          optimizationInfo().inliningMaxCallerBytecodeLength()) {
+    trackOptimizationOutcome(TrackedOutcome::CantInlineBigCaller);
+    return DontInline(targetScript, "Vetoed: caller excessively large");
   }
 
   BaselineScript* outerBaseline =
@@ -4427,8 +4456,17 @@ IonBuilder::InliningDecision IonBuilder::makeInliningDecision(
   //
   // These heuristics only apply to the highest optimization level: other tiers
   // do very little inlining and performance is not as much of a concern there.
-  if (isHighestOptimizationLevel() && targetScript->hasLoops() &&
-      inliningDepth_ >= targetScript->baselineScript()->maxInliningDepth()) {
+  //
+  // A specialized higher-order builtin only needs one more level, for its
+  // callback, which we checked above.
+  if (specializeForCallback) {
+    JitSpew(JitSpew_Inlining,
+            "Specializing %s:%u:%u for its callback at this call site",
+            targetScript->filename(), targetScript->lineno(),
+            targetScript->column());
+  } else if (isHighestOptimizationLevel() && targetScript->hasLoops() &&
+             inliningDepth_ >=
+                 targetScript->baselineScript()->maxInliningDepth()) {
     trackOptimizationOutcome(TrackedOutcome::CantInlineExceededDepth);
     return DontInline(targetScript,
                       "Vetoed: exceeding allowed script inline depth");
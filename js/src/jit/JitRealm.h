@@ -500,6 +500,13 @@ class JitZone {
                 SystemAllocPolicy, IcStubCodeMapGCPolicy<CacheIRStubKey>>;
   BaselineCacheIRStubCodeMap baselineCacheIRStubCodes_;
 
+  // Map ICStub keys to ICStub shared code objects. This code does not depend
+  // on the realm, so it is shared by all realms in the zone.
+  using ICStubCodeMap =
+      GCHashMap<uint32_t, WeakHeapPtrJitCode, DefaultHasher<uint32_t>,
+                SystemAllocPolicy, IcStubCodeMapGCPolicy<uint32_t>>;
+  ICStubCodeMap stubCodes_;
+
  public:
   void sweep();
 
@@ -528,6 +535,23 @@ class JitZone {
     return baselineCacheIRStubCodes_.add(p, std::move(key), stubCode);
   }
 
+  JitCode* getStubCode(uint32_t key) {
+    ICStubCodeMap::Ptr p = stubCodes_.lookup(key);
+    if (p) {
+      return p->value();
+    }
+    return nullptr;
+  }
+  MOZ_MUST_USE bool putStubCode(JSContext* cx, uint32_t key,
+                                Handle<JitCode*> stubCode) {
+    MOZ_ASSERT(stubCode);
+    if (!stubCodes_.putNew(key, stubCode.get())) {
+      ReportOutOfMemory(cx);
+      return false;
+    }
+    return true;
+  }
+
   CacheIRStubInfo* getIonCacheIRStubInfo(const CacheIRStubKey::Lookup& key) {
     IonCacheIRStubInfoSet::Ptr p = ionCacheIRStubInfoSet_.lookup(key);
     return p ? p->stubInfo.get() : nullptr;
@@ -545,12 +569,6 @@ class JitZone {
 class JitRealm {
   friend class JitActivation;
 
-  // Map ICStub keys to ICStub shared code objects.
-  using ICStubCodeMap =
-      GCHashMap<uint32_t, WeakHeapPtrJitCode, DefaultHasher<uint32_t>,
-                ZoneAllocPolicy, IcStubCodeMapGCPolicy<uint32_t>>;
-  ICStubCodeMap* stubCodes_;
-
   // The JitRealm stores stubs to concatenate strings inline and perform RegExp
   // calls inline. These bake in zone and realm specific pointers and can't be
   // stored in JitRuntime. They also are dependent on the value of
@@ -587,23 +605,6 @@ class JitRealm {
   }
 
  public:
-  JitCode* getStubCode(uint32_t key) {
-    ICStubCodeMap::Ptr p = stubCodes_->lookup(key);
-    if (p) {
-      return p->value();
-    }
-    return nullptr;
-  }
-  MOZ_MUST_USE bool putStubCode(JSContext* cx, uint32_t key,
-                                Handle<JitCode*> stubCode) {
-    MOZ_ASSERT(stubCode);
-    if (!stubCodes_->putNew(key, stubCode.get())) {
-      ReportOutOfMemory(cx);
-      return false;
-    }
-    return true;
-  }
-
   JitRealm();
   ~JitRealm();
 
@@ -695,6 +696,37 @@ class JitRealm {
 void InvalidateAll(FreeOp* fop, JS::Zone* zone);
 void FinishInvalidation(FreeOp* fop, JSScript* script);
 
+// While an AutoWritableJitCodeBatch is live, AutoWritableJitCode scopes on the
+// same runtime leave the pages they made writable that way, and the batch
+// makes them all executable again when it ends. Pages shared by several pieces
+// of code are then only reprotected once, and contiguous pages are made
+// executable with a single call. Use this around loops that patch many small
+// pieces of JIT code, such as toggling instrumentation in every script.
+//
+// Code touched inside the batch is not executable until the batch ends, so no
+// JIT code may run while it is live. Nor may a GC, which could reprotect pages
+// behind the batch's back when poisoning dead code.
+class MOZ_RAII AutoWritableJitCodeBatch {
+  JSRuntime* rt_;
+  JS::AutoAssertNoGC nogc_;
+
+  // Start addresses of the pages made writable by this batch.
+  using PageSet = HashSet<uintptr_t, DefaultHasher<uintptr_t>,
+                          SystemAllocPolicy>;
+  PageSet writablePages_;
+
+  void makeAllExecutable();
+
+ public:
+  explicit AutoWritableJitCodeBatch(JSRuntime* rt);
+  ~AutoWritableJitCodeBatch();
+
+  // Make the pages spanning [addr, addr + size) writable if they aren't
+  // already. On failure, the batch makes everything executable again and the
+  // caller must reprotect the range itself.
+  MOZ_MUST_USE bool makeWritable(void* addr, size_t size);
+};
+
 // This class ensures JIT code is executable on its destruction. Creators
 // must call makeWritable(), and not attempt to write to the buffer if it fails.
 //
@@ -705,10 +737,11 @@ class MOZ_RAII AutoWritableJitCodeFallible {
   JSRuntime* rt_;
   void* addr_;
   size_t size_;
+  bool batched_;
 
  public:
   AutoWritableJitCodeFallible(JSRuntime* rt, void* addr, size_t size)
-      : rt_(rt), addr_(addr), size_(size) {
+      : rt_(rt), addr_(addr), size_(size), batched_(false) {
     rt_->toggleAutoWritableJitCodeActive(true);
   }
 
@@ -720,11 +753,17 @@ class MOZ_RAII AutoWritableJitCodeFallible {
                                     code->bufferSize()) {}
 
   MOZ_MUST_USE bool makeWritable() {
+    if (AutoWritableJitCodeBatch* batch = rt_->jitCodeWriteBatch()) {
+      if (batch->makeWritable(addr_, size_)) {
+        batched_ = true;
+        return true;
+      }
+    }
     return ExecutableAllocator::makeWritable(addr_, size_);
   }
 
   ~AutoWritableJitCodeFallible() {
-    if (!ExecutableAllocator::makeExecutable(addr_, size_)) {
+    if (!batched_ && !ExecutableAllocator::makeExecutable(addr_, size_)) {
       MOZ_CRASH();
     }
     rt_->toggleAutoWritableJitCodeActive(false);
@@ -13,6 +13,14 @@
 #  include <unistd.h>
 #endif
 
+#ifdef XP_LINUX
+#  include <elf.h>
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <time.h>
+#endif
+
 #ifdef JS_ION_PERF
 #  include "jit/JitSpewer.h"
 #  include "jit/LIR.h"
@@ -73,6 +81,156 @@ static bool openPerfMap(const char* dir) {
   return true;
 }
 
+#ifdef XP_LINUX
+
+// Optionally, the same entries are also written in perf's jitdump format
+// (see tools/perf/Documentation/jitdump-specification.txt in the Linux
+// tree). Unlike the map file, a jitdump carries a copy of the code and a
+// timestamp for every record, so after |perf record -k mono| and
+// |perf inject --jit| samples in code that has since been discarded or
+// reused are still attributed correctly.
+
+static FILE* JitDumpFilePtr = nullptr;
+
+static void* JitDumpMarker = nullptr;
+
+static uint64_t JitDumpCodeIndex = 0;
+
+static const uint32_t JitDumpMagic = 0x4A695444;  // "JiTD"
+static const uint32_t JitDumpVersion = 1;
+static const uint32_t JitDumpCodeLoad = 0;
+
+struct JitDumpFileHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t totalSize;
+  uint32_t elfMach;
+  uint32_t pad1;
+  uint32_t pid;
+  uint64_t timestamp;
+  uint64_t flags;
+};
+
+struct JitDumpCodeLoadRecord {
+  uint32_t id;
+  uint32_t totalSize;
+  uint64_t timestamp;
+  uint32_t pid;
+  uint32_t tid;
+  uint64_t vma;
+  uint64_t codeAddr;
+  uint64_t codeSize;
+  uint64_t codeIndex;
+};
+
+static uint64_t JitDumpTimestamp() {
+  // This must match perf's clock, hence |perf record -k mono|.
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return uint64_t(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+static uint32_t JitDumpElfMachine() {
+#  if defined(JS_CODEGEN_X64)
+  return EM_X86_64;
+#  elif defined(JS_CODEGEN_X86)
+  return EM_386;
+#  elif defined(JS_CODEGEN_ARM)
+  return EM_ARM;
+#  elif defined(JS_CODEGEN_ARM64)
+  return EM_AARCH64;
+#  elif defined(JS_CODEGEN_MIPS32) || defined(JS_CODEGEN_MIPS64)
+  return EM_MIPS;
+#  else
+  return EM_NONE;
+#  endif
+}
+
+static bool openJitDump(const char* dir) {
+  const ssize_t bufferSize = 256;
+  char filenameBuffer[bufferSize];
+
+  if (snprintf(filenameBuffer, bufferSize, "%sjit-%d.dump", dir, getpid()) >=
+      bufferSize) {
+    return false;
+  }
+
+  int fd = open(filenameBuffer, O_CREAT | O_TRUNC | O_RDWR, 0666);
+  if (fd == -1) {
+    return false;
+  }
+
+  // perf finds the dump through this mapping of it, which shows up as an
+  // mmap event in the recording. It must be executable to be recorded.
+  long pageSize = sysconf(_SC_PAGESIZE);
+  JitDumpMarker =
+      mmap(nullptr, pageSize, PROT_READ | PROT_EXEC, MAP_PRIVATE, fd, 0);
+  if (JitDumpMarker == MAP_FAILED) {
+    JitDumpMarker = nullptr;
+    close(fd);
+    return false;
+  }
+
+  MOZ_ASSERT(!JitDumpFilePtr);
+  JitDumpFilePtr = fdopen(fd, "w");
+  if (!JitDumpFilePtr) {
+    munmap(JitDumpMarker, pageSize);
+    JitDumpMarker = nullptr;
+    close(fd);
+    return false;
+  }
+
+  JitDumpFileHeader header = {};
+  header.magic = JitDumpMagic;
+  header.version = JitDumpVersion;
+  header.totalSize = sizeof(header);
+  header.elfMach = JitDumpElfMachine();
+  header.pid = getpid();
+  header.timestamp = JitDumpTimestamp();
+  fwrite(&header, sizeof(header), 1, JitDumpFilePtr);
+
+  return true;
+}
+
+static void writeJitDumpCodeLoad(uintptr_t address, size_t size,
+                                 const char* name) {
+  MOZ_ASSERT(JitDumpFilePtr);
+
+  size_t nameSize = strlen(name) + 1;
+
+  JitDumpCodeLoadRecord record;
+  record.id = JitDumpCodeLoad;
+  record.totalSize = sizeof(record) + nameSize + size;
+  record.timestamp = JitDumpTimestamp();
+  record.pid = getpid();
+  record.tid = syscall(SYS_gettid);
+  record.vma = address;
+  record.codeAddr = address;
+  record.codeSize = size;
+  record.codeIndex = JitDumpCodeIndex++;
+
+  fwrite(&record, sizeof(record), 1, JitDumpFilePtr);
+  fwrite(name, nameSize, 1, JitDumpFilePtr);
+  fwrite(reinterpret_cast<const void*>(address), size, 1, JitDumpFilePtr);
+}
+
+#endif  // XP_LINUX
+
+static bool openPerfFiles(const char* dir) {
+  if (!openPerfMap(dir)) {
+    return false;
+  }
+
+#ifdef XP_LINUX
+  if (getenv("IONPERF_JITDUMP") && !openJitDump(dir)) {
+    JitSpew(JitSpew_Profiling,
+            "Failed to open jitdump file, only writing perf map.");
+  }
+#endif
+
+  return true;
+}
+
 void js::jit::CheckPerf() {
   if (!PerfChecked) {
     const char* env = getenv("IONPERF");
@@ -92,6 +250,11 @@ void js::jit::CheckPerf() {
       fprintf(stderr, "Use IONPERF=func to record at function granularity\n");
       fprintf(stderr,
               "Use IONPERF=block to record at basic block granularity\n");
+#  ifdef XP_LINUX
+      fprintf(stderr,
+              "Also set IONPERF_JITDUMP to write a jitdump file for "
+              "perf inject\n");
+#  endif
       fprintf(stderr, "\n");
       fprintf(stderr, "Be advised that using IONPERF will cause all scripts\n");
       fprintf(stderr, "to be leaked.\n");
@@ -104,13 +267,13 @@ void js::jit::CheckPerf() {
         MOZ_CRASH("failed to allocate PerfMutex");
       }
 
-      if (openPerfMap(PERF_SPEW_DIR)) {
+      if (openPerfFiles(PERF_SPEW_DIR)) {
         PerfChecked = true;
         return;
       }
 
 #  if defined(__ANDROID__)
-      if (openPerfMap(PERF_SPEW_DIR_2)) {
+      if (openPerfFiles(PERF_SPEW_DIR_2)) {
         PerfChecked = true;
         return;
       }
@@ -144,6 +307,11 @@ struct MOZ_RAII AutoLockPerfMap {
   ~AutoLockPerfMap() {
     MOZ_ASSERT(PerfFilePtr);
     fflush(PerfFilePtr);
+#ifdef XP_LINUX
+    if (JitDumpFilePtr) {
+      fflush(JitDumpFilePtr);
+    }
+#endif
     PerfMutex->unlock();
   }
 };
@@ -192,6 +360,12 @@ void PerfSpewer::WriteEntry(const AutoLockPerfMap&, uintptr_t address,
   va_end(ap);
 
   fprintf(PerfFilePtr, "%" PRIxPTR " %zx %s\n", address, size, result.get());
+
+#ifdef XP_LINUX
+  if (JitDumpFilePtr) {
+    writeJitDumpCodeLoad(address, size, result.get());
+  }
+#endif
 }
 
 void PerfSpewer::writeProfile(JSScript* script, JitCode* code,
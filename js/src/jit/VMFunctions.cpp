@@ -27,6 +27,7 @@
 #include "jit/VMFunctionList-inl.h"
 #include "vm/Debugger-inl.h"
 #include "vm/Interpreter-inl.h"
+#include "vm/JSContext-inl.h"
 #include "vm/JSScript-inl.h"
 #include "vm/NativeObject-inl.h"
 #include "vm/StringObject-inl.h"
@@ -1634,12 +1635,55 @@ static MOZ_ALWAYS_INLINE bool GetNativeDataPropertyPure(JSContext* cx,
 
   MOZ_ASSERT(JSID_IS_ATOM(id) || JSID_IS_SYMBOL(id));
 
+  Shape* receiverShape = obj->lastProperty();
+  MegamorphicCache& cache = cx->caches().megamorphicCache;
+  MegamorphicCache::Entry* entry;
+  if (cache.lookup(receiverShape, id, &entry)) {
+    NativeObject* holder = obj;
+    bool valid = true;
+    for (size_t i = 0; i < entry->numHops(); i++) {
+      JSObject* proto = holder->staticPrototype();
+      if (!proto || !proto->isNative() ||
+          proto->as<NativeObject>().lastProperty() != entry->protoShape(i)) {
+        valid = false;
+        break;
+      }
+      holder = &proto->as<NativeObject>();
+    }
+
+    if (valid) {
+      if (!entry->isMissing()) {
+        *vp = holder->getSlot(entry->slot());
+        return true;
+      }
+      if (!holder->staticPrototype()) {
+        if (HandleMissing) {
+          vp->setUndefined();
+          return true;
+        }
+        return false;
+      }
+    }
+  }
+
+  // Record the shapes of the prototypes we walk so the result can be cached.
+  // Dictionary shapes can change in place, and resolve hooks can add the
+  // property lazily, so give up on caching if we see either.
+  Shape* protoShapes[MegamorphicCache::MaxHops];
+  size_t numHops = 0;
+  bool cacheable = !receiverShape->inDictionary();
+
   while (true) {
     if (Shape* shape = obj->lastProperty()->search(cx, id)) {
       if (!shape->isDataProperty()) {
         return false;
       }
 
+      if (cacheable) {
+        cache.initEntryForDataProperty(entry, receiverShape, id, protoShapes,
+                                       numHops, shape->slot());
+      }
+
       *vp = obj->getSlot(shape->slot());
       return true;
     }
@@ -1649,11 +1693,18 @@ static MOZ_ALWAYS_INLINE bool GetNativeDataPropertyPure(JSContext* cx,
       if (ClassMayResolveId(cx->names(), obj->getClass(), id, obj)) {
         return false;
       }
+      if (obj->getClass()->getResolve()) {
+        cacheable = false;
+      }
     }
 
     JSObject* proto = obj->staticPrototype();
     if (!proto) {
       if (HandleMissing) {
+        if (cacheable) {
+          cache.initEntryForMissingProperty(entry, receiverShape, id,
+                                            protoShapes, numHops);
+        }
         vp->setUndefined();
         return true;
       }
@@ -1664,6 +1715,14 @@ static MOZ_ALWAYS_INLINE bool GetNativeDataPropertyPure(JSContext* cx,
       return false;
     }
     obj = &proto->as<NativeObject>();
+
+    if (cacheable) {
+      if (numHops == MegamorphicCache::MaxHops || obj->inDictionaryMode()) {
+        cacheable = false;
+      } else {
+        protoShapes[numHops++] = obj->lastProperty();
+      }
+    }
   }
 }
 
@@ -412,7 +412,8 @@ JS_PUBLIC_API JS::ContextOptions& JS::ContextOptionsRef(JSContext* cx) {
   return cx->options();
 }
 
-JS_PUBLIC_API bool JS::InitSelfHostedCode(JSContext* cx) {
+JS_PUBLIC_API bool JS::InitSelfHostedCode(JSContext* cx, SelfHostedCache cache,
+                                          SelfHostedWriter writer) {
   MOZ_RELEASE_ASSERT(!cx->runtime()->hasInitializedSelfHosting(),
                      "JS::InitSelfHostedCode() called more than once");
 
@@ -430,7 +431,7 @@ JS_PUBLIC_API bool JS::InitSelfHostedCode(JSContext* cx) {
   }
 #endif
 
-  if (!rt->initSelfHosting(cx)) {
+  if (!rt->initSelfHosting(cx, cache, writer)) {
     return false;
   }
 
@@ -3471,6 +3472,7 @@ void JS::TransitiveCompileOptions::copyPODTransitiveOptions(
   forceAsync = rhs.forceAsync;
   discardSource = rhs.discardSource;
   sourceIsLazy = rhs.sourceIsLazy;
+  lazilyParseLazySource = rhs.lazilyParseLazySource;
   introductionType = rhs.introductionType;
   introductionLineno = rhs.introductionLineno;
   introductionOffset = rhs.introductionOffset;
@@ -3636,6 +3638,14 @@ JS_PUBLIC_API JSScript* JS::FinishOffThreadBinASTDecode(
   MOZ_ASSERT(CurrentThreadCanAccessRuntime(cx->runtime()));
   return HelperThreadState().finishBinASTDecodeTask(cx, token);
 }
+
+JS_PUBLIC_API void JS::CancelOffThreadBinASTDecode(JSContext* cx,
+                                                  JS::OffThreadToken* token) {
+  MOZ_ASSERT(cx);
+  MOZ_ASSERT(CurrentThreadCanAccessRuntime(cx->runtime()));
+  HelperThreadState().cancelParseTask(cx->runtime(), ParseTaskKind::BinAST,
+                                      token);
+}
 #endif
 
 JS_PUBLIC_API JSObject* JS_GetGlobalFromScript(JSScript* script) {
@@ -4632,6 +4642,14 @@ JS_PUBLIC_API bool JS_ParseJSON(JSContext* cx, const char16_t* chars,
                               NullHandleValue, vp);
 }
 
+JS_PUBLIC_API bool JS_ParseJSON(JSContext* cx, const Latin1Char* chars,
+                                uint32_t len, MutableHandleValue vp) {
+  AssertHeapIsIdle();
+  CHECK_THREAD(cx);
+  return ParseJSONWithReviver(cx, mozilla::Range<const Latin1Char>(chars, len),
+                              NullHandleValue, vp);
+}
+
 JS_PUBLIC_API bool JS_ParseJSON(JSContext* cx, HandleString str,
                                 MutableHandleValue vp) {
   return JS_ParseJSONWithReviver(cx, str, NullHandleValue, vp);
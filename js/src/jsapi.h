@@ -384,8 +384,15 @@ namespace JS {
  * Initialize the runtime's self-hosted code. Embeddings should call this
  * exactly once per runtime/context, before the first JS_NewGlobalObject
  * call.
+ *
+ * If |cache| is non-empty it is decoded instead of compiling the self-hosted
+ * sources; a cache that fails to decode (e.g. from a different build) is
+ * ignored. When the sources are compiled and |writer| is provided, it is
+ * given the encoded script so that it can be saved for other runtimes.
  */
-JS_PUBLIC_API bool InitSelfHostedCode(JSContext* cx);
+JS_PUBLIC_API bool InitSelfHostedCode(JSContext* cx,
+                                      SelfHostedCache cache = nullptr,
+                                      SelfHostedWriter writer = nullptr);
 
 /**
  * Asserts (in debug and release builds) that `obj` belongs to the current
@@ -1978,6 +1985,9 @@ extern JS_PUBLIC_API bool DecodeBinASTOffThread(
 extern JS_PUBLIC_API JSScript* FinishOffThreadBinASTDecode(
     JSContext* cx, OffThreadToken* token);
 
+extern JS_PUBLIC_API void CancelOffThreadBinASTDecode(JSContext* cx,
+                                                      OffThreadToken* token);
+
 } /* namespace JS */
 
 #endif /* JS_BUILD_BINAST */
@@ -30,6 +30,8 @@
 
 namespace js {
 
+class AutoLockHelperThreadState;
+
 // Take all atoms table locks to allow iterating over cells in the atoms zone.
 class MOZ_RAII AutoLockAllAtoms {
   JSRuntime* runtime;
@@ -94,6 +96,10 @@ class AtomsTable {
 
     // Set of atoms added while the |atoms| set is being swept.
     AtomSet* atomsAddedWhileSweeping;
+
+    // Sweeping position in |atoms|, if sweeping this partition has started
+    // but not yet finished.
+    mozilla::Maybe<AtomSet::Enum> atomsToSweep;
   };
 
   Partition* partitions[PartitionCount];
@@ -105,22 +111,31 @@ class AtomsTable {
  public:
   class AutoLock;
 
-  // An iterator used for sweeping atoms incrementally.
+  // The list of partitions still to be swept during incremental sweeping.
+  // Partitions are handed out to sweeping threads one at a time so that
+  // several can be swept in parallel. A partition whose sweeping was cut short
+  // by the slice budget stays on the list and is resumed by a later slice.
+  //
+  // All methods must be called with the helper thread lock held.
   class SweepIterator {
-    AtomsTable& atoms;
-    size_t partitionIndex;
-    mozilla::Maybe<AtomSet::Enum> atomsIter;
+    static_assert(PartitionCount <= 32, "Partition sets must fit in a word");
 
-    void settle();
-    void startSweepingPartition();
-    void finishSweepingPartition();
+    uint32_t unsweptPartitions;
+    uint32_t claimedPartitions;
 
    public:
-    explicit SweepIterator(AtomsTable& atoms);
-    bool empty() const;
-    JSAtom* front() const;
-    void removeFront();
-    void popFront();
+    SweepIterator();
+    ~SweepIterator() { MOZ_ASSERT(!claimedPartitions); }
+
+    bool empty(AutoLockHelperThreadState& lock) const;
+
+    // Find an unswept partition that no other thread is sweeping and claim
+    // it. Returns false if there are none.
+    bool claim(size_t* indexp, AutoLockHelperThreadState& lock);
+
+    // Give up a partition claimed above, recording whether it has now been
+    // completely swept.
+    void release(size_t index, bool finished, AutoLockHelperThreadState& lock);
   };
 
   ~AtomsTable();
@@ -151,8 +166,11 @@ class AtomsTable {
 
   bool startIncrementalSweep();
 
-  // Sweep some atoms incrementally and return whether we finished.
-  bool sweepIncrementally(SweepIterator& atomsToSweep, SliceBudget& budget);
+  // Sweep up to |maxSteps| atoms of a partition previously claimed from a
+  // SweepIterator and return whether the partition is now completely swept.
+  // This does not take the partition lock and may be called for different
+  // partitions on different threads at the same time.
+  bool sweepPartitionIncrementally(size_t index, size_t maxSteps);
 
 #ifdef DEBUG
   bool mainThreadHasAllLocks() const { return allPartitionsLocked; }
@@ -1681,10 +1681,34 @@ BigInt* BigInt::copy(JSContext* cx, HandleBigInt x) {
   return result;
 }
 
+BigInt* BigInt::absoluteSubOneDigit(JSContext* cx, Digit x, Digit y,
+                                    bool xNegative) {
+  if (x == y) {
+    return zero(cx);
+  }
+  if (x > y) {
+    return createFromDigit(cx, x - y, xNegative);
+  }
+  return createFromDigit(cx, y - x, !xNegative);
+}
+
 // BigInt proposal section 1.1.7
 BigInt* BigInt::add(JSContext* cx, HandleBigInt x, HandleBigInt y) {
   bool xNegative = x->isNegative();
 
+  // Fast path for the common case of single-digit operands.
+  if (x->digitLength() == 1 && y->digitLength() == 1) {
+    if (xNegative == y->isNegative()) {
+      Digit carry = 0;
+      Digit sum = digitAdd(x->digit(0), y->digit(0), &carry);
+      if (!carry) {
+        return createFromDigit(cx, sum, xNegative);
+      }
+    } else {
+      return absoluteSubOneDigit(cx, x->digit(0), y->digit(0), xNegative);
+    }
+  }
+
   // x + y == x + y
   // -x + -y == -(x + y)
   if (xNegative == y->isNegative()) {
@@ -1703,6 +1727,19 @@ BigInt* BigInt::add(JSContext* cx, HandleBigInt x, HandleBigInt y) {
 // BigInt proposal section 1.1.8
 BigInt* BigInt::sub(JSContext* cx, HandleBigInt x, HandleBigInt y) {
   bool xNegative = x->isNegative();
+
+  // Fast path for the common case of single-digit operands.
+  if (x->digitLength() == 1 && y->digitLength() == 1) {
+    if (xNegative != y->isNegative()) {
+      Digit carry = 0;
+      Digit sum = digitAdd(x->digit(0), y->digit(0), &carry);
+      if (!carry) {
+        return createFromDigit(cx, sum, xNegative);
+      }
+    } else {
+      return absoluteSubOneDigit(cx, x->digit(0), y->digit(0), xNegative);
+    }
+  }
   if (xNegative != y->isNegative()) {
     // x - (-y) == x + y
     // (-x) - y == -(x + y)
@@ -1726,8 +1763,18 @@ BigInt* BigInt::mul(JSContext* cx, HandleBigInt x, HandleBigInt y) {
     return y;
   }
 
-  unsigned resultLength = x->digitLength() + y->digitLength();
   bool resultNegative = x->isNegative() != y->isNegative();
+
+  // Fast path for the common case of single-digit operands.
+  if (x->digitLength() == 1 && y->digitLength() == 1) {
+    Digit high = 0;
+    Digit low = digitMul(x->digit(0), y->digit(0), &high);
+    if (!high) {
+      return createFromDigit(cx, low, resultNegative);
+    }
+  }
+
+  unsigned resultLength = x->digitLength() + y->digitLength();
   RootedBigInt result(cx,
                       createUninitialized(cx, resultLength, resultNegative));
   if (!result) {
@@ -330,6 +330,11 @@ class BigInt final : public js::gc::TenuredCell {
   static BigInt* absoluteSub(JSContext* cx, Handle<BigInt*> x,
                              Handle<BigInt*> y, bool resultNegative);
 
+  // Return `(x - y) * (xNegative ? -1 : +1)` for single-digit magnitudes `x`
+  // and `y`, without any precondition on their order.
+  static BigInt* absoluteSubOneDigit(JSContext* cx, Digit x, Digit y,
+                                     bool xNegative);
+
   // If `|x| < |y|` return -1; if `|x| == |y|` return 0; otherwise return 1.
   static int8_t absoluteCompare(BigInt* lhs, BigInt* rhs);
 
@@ -7,6 +7,9 @@
 #ifndef vm_Caches_h
 #define vm_Caches_h
 
+#include "mozilla/HashFunctions.h"
+#include "mozilla/MathAlgorithms.h"
+
 #include <new>
 
 #include "jsmath.h"
@@ -221,10 +224,106 @@ class NewObjectCache {
   }
 };
 
+/*
+ * Cache for the megamorphic property lookup stubs in CacheIR. Maps a receiver
+ * shape and property id to the result of the last lookup: either the number
+ * of prototypes walked to reach the object holding the data property and the
+ * property's slot, or that the property is missing from the whole chain.
+ *
+ * Prototypes are stored in the object's group rather than its shape, so a hit
+ * is validated by walking the prototype chain and checking each prototype's
+ * shape against the shapes recorded when the entry was filled. That turns a
+ * property search on every object into a pointer comparison. Only
+ * non-dictionary shapes are recorded, since those are never mutated in place.
+ *
+ * Entries hold raw shape pointers, so the cache is purged on every major GC
+ * and before compacting.
+ */
+class MegamorphicCache {
+ public:
+  // The maximum number of prototypes an entry can walk.
+  static const size_t MaxHops = 4;
+
+  class Entry {
+    friend class MegamorphicCache;
+
+    Shape* shape_ = nullptr;
+    jsid id_;
+    Shape* protoShapes_[MaxHops] = {};
+    uint32_t slot_ = 0;
+    uint8_t numHops_ = 0;
+    bool isMissing_ = false;
+
+   public:
+    size_t numHops() const { return numHops_; }
+    Shape* protoShape(size_t i) const {
+      MOZ_ASSERT(i < numHops_);
+      return protoShapes_[i];
+    }
+    bool isMissing() const { return isMissing_; }
+    uint32_t slot() const {
+      MOZ_ASSERT(!isMissing_);
+      return slot_;
+    }
+  };
+
+  // Return whether |entry| matches the shape and id. On a miss, |entry| can be
+  // filled in once the lookup has been done the slow way.
+  bool lookup(Shape* shape, jsid id, Entry** entry) {
+    *entry = &entries_[hash(shape, id)];
+    return (*entry)->shape_ == shape && (*entry)->id_ == id;
+  }
+
+  void initEntryForDataProperty(Entry* entry, Shape* shape, jsid id,
+                                Shape* const* protoShapes, size_t numHops,
+                                uint32_t slot) {
+    init(entry, shape, id, protoShapes, numHops);
+    entry->slot_ = slot;
+  }
+
+  void initEntryForMissingProperty(Entry* entry, Shape* shape, jsid id,
+                                   Shape* const* protoShapes, size_t numHops) {
+    init(entry, shape, id, protoShapes, numHops);
+    entry->isMissing_ = true;
+  }
+
+  void purge() {
+    for (Entry& entry : entries_) {
+      entry = Entry();
+    }
+  }
+
+ private:
+  static const size_t NumEntries = 512;
+  static_assert(mozilla::IsPowerOfTwo(NumEntries),
+                "NumEntries must be a power of two");
+
+  Entry entries_[NumEntries];
+
+  static size_t hash(Shape* shape, jsid id) {
+    return mozilla::HashGeneric(shape, JSID_BITS(id)) & (NumEntries - 1);
+  }
+
+  void init(Entry* entry, Shape* shape, jsid id, Shape* const* protoShapes,
+            size_t numHops) {
+    MOZ_ASSERT(entry == &entries_[hash(shape, id)]);
+    MOZ_ASSERT(numHops <= MaxHops);
+
+    *entry = Entry();
+    entry->shape_ = shape;
+    entry->id_ = id;
+    for (size_t i = 0; i < numHops; i++) {
+      entry->protoShapes_[i] = protoShapes[i];
+    }
+    entry->numHops_ = uint8_t(numHops);
+  }
+};
+
 class RuntimeCaches {
  public:
   js::GSNCache gsnCache;
   js::NewObjectCache newObjectCache;
+  js::MegamorphicCache megamorphicCache;
   js::UncompressedSourceCache uncompressedSourceCache;
   js::EvalCache evalCache;
 
@@ -235,6 +334,7 @@ class RuntimeCaches {
 
   void purgeForCompaction() {
     newObjectCache.purge();
+    megamorphicCache.purge();
     evalCache.clear();
   }
 
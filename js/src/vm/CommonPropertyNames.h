@@ -20,8 +20,12 @@
   MACRO(args, args, "args")                                                    \
   MACRO(arguments, arguments, "arguments")                                     \
   MACRO(ArrayBufferSpecies, ArrayBufferSpecies, "$ArrayBufferSpecies")         \
+  MACRO(ArrayFilter, ArrayFilter, "ArrayFilter")                               \
+  MACRO(ArrayForEach, ArrayForEach, "ArrayForEach")                            \
   MACRO(ArrayIterator, ArrayIterator, "Array Iterator")                        \
   MACRO(ArrayIteratorNext, ArrayIteratorNext, "ArrayIteratorNext")             \
+  MACRO(ArrayMap, ArrayMap, "ArrayMap")                                        \
+  MACRO(ArrayReduce, ArrayReduce, "ArrayReduce")                               \
   MACRO(ArraySort, ArraySort, "ArraySort")                                     \
   MACRO(ArraySpecies, ArraySpecies, "$ArraySpecies")                           \
   MACRO(ArraySpeciesCreate, ArraySpeciesCreate, "ArraySpeciesCreate")          \
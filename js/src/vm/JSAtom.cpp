@@ -12,6 +12,7 @@
 
 #include "mozilla/ArrayUtils.h"
 #include "mozilla/EndianUtils.h"
+#include "mozilla/MathAlgorithms.h"
 #include "mozilla/RangedPtr.h"
 #include "mozilla/Unused.h"
 
@@ -346,7 +347,10 @@ AtomsTable::Partition::Partition(uint32_t index)
       atoms(InitialTableSize),
       atomsAddedWhileSweeping(nullptr) {}
 
-AtomsTable::Partition::~Partition() { MOZ_ASSERT(!atomsAddedWhileSweeping); }
+AtomsTable::Partition::~Partition() {
+  MOZ_ASSERT(!atomsAddedWhileSweeping);
+  MOZ_ASSERT(!atomsToSweep);
+}
 
 AtomsTable::~AtomsTable() {
   for (size_t i = 0; i < PartitionCount; i++) {
@@ -483,53 +487,36 @@ void AtomsTable::sweepAll(JSRuntime* rt) {
   }
 }
 
-AtomsTable::SweepIterator::SweepIterator(AtomsTable& atoms)
-    : atoms(atoms), partitionIndex(0) {
-  startSweepingPartition();
-  settle();
-}
+AtomsTable::SweepIterator::SweepIterator()
+    : unsweptPartitions(uint32_t((uint64_t(1) << PartitionCount) - 1)),
+      claimedPartitions(0) {}
 
-inline void AtomsTable::SweepIterator::startSweepingPartition() {
-  MOZ_ASSERT(atoms.partitions[partitionIndex]->atomsAddedWhileSweeping);
-  atomsIter.emplace(atoms.partitions[partitionIndex]->atoms);
+bool AtomsTable::SweepIterator::empty(AutoLockHelperThreadState& lock) const {
+  return !unsweptPartitions;
 }
 
-inline void AtomsTable::SweepIterator::finishSweepingPartition() {
-  atomsIter.reset();
-  atoms.mergeAtomsAddedWhileSweeping(*atoms.partitions[partitionIndex]);
-}
-
-inline void AtomsTable::SweepIterator::settle() {
-  MOZ_ASSERT(!empty());
-
-  while (atomsIter->empty()) {
-    finishSweepingPartition();
-    partitionIndex++;
-    if (empty()) {
-      return;
-    }
-    startSweepingPartition();
+bool AtomsTable::SweepIterator::claim(size_t* indexp,
+                                      AutoLockHelperThreadState& lock) {
+  uint32_t available = unsweptPartitions & ~claimedPartitions;
+  if (!available) {
+    return false;
   }
-}
-
-inline bool AtomsTable::SweepIterator::empty() const {
-  return partitionIndex == PartitionCount;
-}
 
-inline JSAtom* AtomsTable::SweepIterator::front() const {
-  MOZ_ASSERT(!empty());
-  return atomsIter->front().unbarrieredGet();
-}
-
-inline void AtomsTable::SweepIterator::removeFront() {
-  MOZ_ASSERT(!empty());
-  return atomsIter->removeFront();
+  size_t index = mozilla::CountTrailingZeroes32(available);
+  claimedPartitions |= uint32_t(1) << index;
+  *indexp = index;
+  return true;
 }
 
-inline void AtomsTable::SweepIterator::popFront() {
-  MOZ_ASSERT(!empty());
-  atomsIter->popFront();
-  settle();
+void AtomsTable::SweepIterator::release(size_t index, bool finished,
+                                        AutoLockHelperThreadState& lock) {
+  uint32_t bit = uint32_t(1) << index;
+  MOZ_ASSERT(claimedPartitions & bit);
+  MOZ_ASSERT(unsweptPartitions & bit);
+  claimedPartitions &= ~bit;
+  if (finished) {
+    unsweptPartitions &= ~bit;
+  }
 }
 
 bool AtomsTable::startIncrementalSweep() {
@@ -579,30 +566,34 @@ void AtomsTable::mergeAtomsAddedWhileSweeping(Partition& part) {
   js_delete(newAtoms);
 }
 
-bool AtomsTable::sweepIncrementally(SweepIterator& atomsToSweep,
-                                    SliceBudget& budget) {
-  // Sweep the table incrementally until we run out of work or budget.
-  while (!atomsToSweep.empty()) {
-    budget.step();
-    if (budget.isOverBudget()) {
+bool AtomsTable::sweepPartitionIncrementally(size_t index, size_t maxSteps) {
+  Partition& part = *partitions[index];
+  MOZ_ASSERT(part.atomsAddedWhileSweeping);
+
+  if (!part.atomsToSweep) {
+    part.atomsToSweep.emplace(part.atoms);
+  }
+
+  AtomSet::Enum& e = part.atomsToSweep.ref();
+  for (size_t steps = 0; !e.empty(); e.popFront()) {
+    if (steps++ == maxSteps) {
       return false;
     }
 
-    JSAtom* atom = atomsToSweep.front();
+    JSAtom* atom = e.front().unbarrieredGet();
     MOZ_DIAGNOSTIC_ASSERT(atom);
     if (IsAboutToBeFinalizedUnbarriered(&atom)) {
       MOZ_ASSERT(!atom->isPinned());
-      atomsToSweep.removeFront();
+      e.removeFront();
     } else {
-      MOZ_ASSERT(atom == atomsToSweep.front());
+      MOZ_ASSERT(atom == e.front().unbarrieredGet());
     }
-    atomsToSweep.popFront();
-  }
-
-  for (size_t i = 0; i < PartitionCount; i++) {
-    MOZ_ASSERT(!partitions[i]->atomsAddedWhileSweeping);
   }
 
+  // Destroying the enumerator may compact the table, so do it before adding
+  // the atoms that were created while we were sweeping.
+  part.atomsToSweep.reset();
+  mergeAtomsAddedWhileSweeping(part);
   return true;
 }
 
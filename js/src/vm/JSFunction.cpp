@@ -1609,6 +1609,17 @@ bool JSFunction::createScriptForLazilyInterpretedFunction(JSContext* cx,
       MOZ_CRASH("Trying to delazify BinAST function in non-BinAST build");
 #endif /*JS_BUILD_BINAST */
     } else {
+      // Lazy source has to be brought back by the SourceHook before the
+      // function can be compiled.
+      bool haveSource;
+      if (!ScriptSource::loadSource(cx, lazy->scriptSource(), &haveSource)) {
+        return false;
+      }
+      if (!haveSource) {
+        JS_ReportErrorNumberASCII(cx, GetErrorMessage, nullptr,
+                                  JSMSG_LAZY_SOURCE_UNAVAILABLE);
+        return false;
+      }
       MOZ_ASSERT(lazy->scriptSource()->hasSourceText());
 
       // Parse and compile the script from source.
@@ -6,11 +6,18 @@
 
 #include "vm/JSONParser.h"
 
+#include "mozilla/MathAlgorithms.h"
 #include "mozilla/Range.h"
 #include "mozilla/RangedPtr.h"
 #include "mozilla/Sprintf.h"
 #include "mozilla/TextUtils.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define JS_JSON_SCAN_SSE2
+#  include <emmintrin.h>
+#endif
+
 #include "jsnum.h"
 
 #include "builtin/Array.h"
@@ -95,6 +102,55 @@ void JSONParser<CharT>::error(const char* msg) {
 
 bool JSONParserBase::errorReturn() { return errorHandling == NoError; }
 
+static inline bool IsJSONStringSpecialChar(char16_t c) {
+  return c == '"' || c == '\\' || c <= 0x001F;
+}
+
+#ifdef JS_JSON_SCAN_SSE2
+// Return the number of leading code units in |chunk| that cannot end a run of
+// plain string characters, i.e. the index of the first '"', '\\' or control
+// character, or |Width| if there is none.
+static inline size_t PlainStringPrefix(__m128i chunk, const Latin1Char*) {
+  __m128i special = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('"')),
+                   _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\'))),
+      // A saturating subtract leaves zero exactly for c <= 0x1F.
+      _mm_cmpeq_epi8(_mm_subs_epu8(chunk, _mm_set1_epi8(0x1F)),
+                     _mm_setzero_si128()));
+  int mask = _mm_movemask_epi8(special);
+  return mask ? mozilla::CountTrailingZeroes32(uint32_t(mask)) : 16;
+}
+
+static inline size_t PlainStringPrefix(__m128i chunk, const char16_t*) {
+  __m128i special = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi16(chunk, _mm_set1_epi16('"')),
+                   _mm_cmpeq_epi16(chunk, _mm_set1_epi16('\\'))),
+      _mm_cmpeq_epi16(_mm_subs_epu16(chunk, _mm_set1_epi16(0x1F)),
+                      _mm_setzero_si128()));
+  int mask = _mm_movemask_epi8(special);
+  return mask ? mozilla::CountTrailingZeroes32(uint32_t(mask)) / 2 : 8;
+}
+#endif
+
+template <typename CharT>
+const CharT* js::SkipPlainJSONStringChars(const CharT* s, const CharT* limit) {
+#ifdef JS_JSON_SCAN_SSE2
+  const size_t width = 16 / sizeof(CharT);
+  while (size_t(limit - s) >= width) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+    size_t n = PlainStringPrefix(chunk, s);
+    s += n;
+    if (n < width) {
+      return s;
+    }
+  }
+#endif
+  while (s < limit && !IsJSONStringSpecialChar(*s)) {
+    s++;
+  }
+  return s;
+}
+
 template <typename CharT>
 template <JSONParserBase::StringType ST>
 JSONParserBase::Token JSONParser<CharT>::readString() {
@@ -116,6 +172,7 @@ JSONParserBase::Token JSONParser<CharT>::readString() {
    * string directly from the source text.
    */
   CharPtr start = current;
+  current += SkipPlainJSONStringChars(current.get(), end.get()) - current.get();
   for (; current < end; current++) {
     if (*current == '"') {
       size_t length = current - start;
@@ -239,11 +296,7 @@ JSONParserBase::Token JSONParser<CharT>::readString() {
     }
 
     start = current;
-    for (; current < end; current++) {
-      if (*current == '"' || *current == '\\' || *current <= 0x001F) {
-        break;
-      }
-    }
+    current += SkipPlainJSONStringChars(current.get(), end.get()) - current.get();
   } while (current < end);
 
   error("unterminated string");
@@ -816,5 +869,10 @@ bool JSONParser<CharT>::parse(MutableHandleValue vp) {
   return true;
 }
 
+template const Latin1Char* js::SkipPlainJSONStringChars(const Latin1Char* s,
+                                                       const Latin1Char* limit);
+template const char16_t* js::SkipPlainJSONStringChars(const char16_t* s,
+                                                     const char16_t* limit);
+
 template class js::JSONParser<Latin1Char>;
 template class js::JSONParser<char16_t>;
@@ -275,6 +275,13 @@ class MutableWrappedPtrOperations<JSONParser<CharT>, Wrapper>
   }
 };
 
+// Return a pointer to the first '"', '\\' or control character in
+// [s, limit), or |limit| if there is none.  These are exactly the characters
+// that end a run of unescaped characters in a JSON string literal.
+template <typename CharT>
+extern const CharT* SkipPlainJSONStringChars(const CharT* s,
+                                             const CharT* limit);
+
 } /* namespace js */
 
 #endif /* vm_JSONParser_h */
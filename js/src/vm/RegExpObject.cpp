@@ -920,6 +920,8 @@ void RegExpShared::traceChildren(JSTracer* trc) {
 void RegExpShared::discardJitCode() {
   for (auto& comp : compilationArray) {
     comp.jitCode = nullptr;
+    comp.interpretCount = 0;
+    comp.triedNative = false;
   }
 
   // We can also purge the tables used by JIT code.
@@ -997,6 +999,13 @@ bool RegExpShared::compile(JSContext* cx, MutableHandleRegExpShared re,
     compilation.jitCode = code.jitCode;
   } else if (code.byteCode) {
     MOZ_ASSERT(tables.empty(), "RegExpInterpreter does not use data tables");
+    if (compilation.byteCode) {
+      // Tiering up fell back to bytecode again (native regexps can be
+      // disabled, or we may be short on executable memory); keep the
+      // bytecode we already have.
+      js_free(code.byteCode);
+      return true;
+    }
     compilation.byteCode = code.byteCode;
     AddCellMemory(re, compilation.byteCodeLength(),
                   MemoryUse::RegExpSharedBytecode);
@@ -1017,6 +1026,34 @@ bool RegExpShared::compileIfNecessary(JSContext* cx,
   return compile(cx, re, input, mode, force);
 }
 
+// Number of times a regexp is run in the bytecode interpreter before it gets
+// compiled to native code. Most regexps on a page only run a handful of
+// times, and for those the native compile costs more than it saves.
+static const uint32_t RegExpTierUpInterpretCount = 8;
+
+// Inputs at least this long get native code right away, since the time spent
+// matching will dwarf the compile.
+static const size_t RegExpTierUpInputLength = 1000;
+
+bool RegExpShared::shouldCompileNative(CompilationMode mode, bool latin1,
+                                       size_t inputLength) {
+  RegExpCompilation& comp = compilation(mode, latin1);
+  MOZ_ASSERT(!comp.jitCode);
+
+  if (comp.triedNative) {
+    return false;
+  }
+
+  if (inputLength < RegExpTierUpInputLength &&
+      comp.interpretCount < RegExpTierUpInterpretCount) {
+    comp.interpretCount++;
+    return false;
+  }
+
+  comp.triedNative = true;
+  return true;
+}
+
 /* static */
 RegExpRunStatus RegExpShared::execute(JSContext* cx,
                                       MutableHandleRegExpShared re,
@@ -1030,8 +1067,15 @@ RegExpRunStatus RegExpShared::execute(JSContext* cx,
   CompilationMode mode = matches ? Normal : MatchOnly;
 
   /* Compile the code at point-of-use. */
-  if (!compileIfNecessary(cx, re, input, mode, DontForceByteCode)) {
-    return RegExpRunStatus_Error;
+  bool latin1 = input->hasLatin1Chars();
+  if (!re->compilation(mode, latin1).jitCode) {
+    if (re->shouldCompileNative(mode, latin1, input->length())) {
+      if (!compile(cx, re, input, mode, DontForceByteCode)) {
+        return RegExpRunStatus_Error;
+      }
+    } else if (!compileIfNecessary(cx, re, input, mode, ForceByteCode)) {
+      return RegExpRunStatus_Error;
+    }
   }
 
   /*
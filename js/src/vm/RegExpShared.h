@@ -88,6 +88,11 @@ class RegExpShared : public gc::TenuredCell {
     WeakHeapPtr<jit::JitCode*> jitCode;
     uint8_t* byteCode = nullptr;
 
+    // Regexps start out in the bytecode interpreter; these track when to
+    // tier up to native code. See RegExpShared::shouldCompileNative.
+    uint32_t interpretCount = 0;
+    bool triedNative = false;
+
     bool compiled(ForceByteCodeEnum force = DontForceByteCode) const {
       return byteCode || (force == DontForceByteCode && jitCode);
     }
@@ -131,6 +136,9 @@ class RegExpShared : public gc::TenuredCell {
                       HandleAtom pattern, HandleLinearString input,
                       CompilationMode mode, ForceByteCodeEnum force);
 
+  bool shouldCompileNative(CompilationMode mode, bool latin1,
+                           size_t inputLength);
+
   static bool compileIfNecessary(JSContext* cx, MutableHandleRegExpShared res,
                                  HandleLinearString input, CompilationMode mode,
                                  ForceByteCodeEnum force);
@@ -156,6 +156,7 @@ JSRuntime::JSRuntime(JSRuntime* parentRuntime)
       offThreadParsingBlocked_(false),
 #endif
       autoWritableJitCodeActive_(false),
+      jitCodeWriteBatch_(nullptr),
       oomCallback(nullptr),
       debuggerMallocSizeOf(ReturnZeroSize),
       stackFormat_(parentRuntime ? js::StackFormat::Default
@@ -40,6 +40,7 @@
 #endif
 #include "js/Stream.h"
 #include "js/Symbol.h"
+#include "js/Transcoding.h"  // JS::SelfHosted{Cache,Writer}
 #include "js/UniquePtr.h"
 #include "js/Utility.h"
 #include "js/Vector.h"
@@ -97,6 +98,7 @@ class Activation;
 class ActivationIterator;
 
 namespace jit {
+class AutoWritableJitCodeBatch;
 class JitRuntime;
 class JitActivation;
 struct PcScriptCache;
@@ -602,7 +604,8 @@ struct JSRuntime : public js::MallocProvider<JSRuntime> {
 
   bool hasInitializedSelfHosting() const { return selfHostingGlobal_; }
 
-  bool initSelfHosting(JSContext* cx);
+  bool initSelfHosting(JSContext* cx, JS::SelfHostedCache xdrCache = nullptr,
+                       JS::SelfHostedWriter xdrWriter = nullptr);
   void finishSelfHosting();
   void traceSelfHostingGlobal(JSTracer* trc);
   bool isSelfHostingGlobal(JSObject* global) {
@@ -872,6 +875,7 @@ struct JSRuntime : public js::MallocProvider<JSRuntime> {
 #endif
 
   js::MainThreadData<bool> autoWritableJitCodeActive_;
+  js::MainThreadData<js::jit::AutoWritableJitCodeBatch*> jitCodeWriteBatch_;
 
  public:
   // Note: these values may be toggled dynamically (in response to about:config
@@ -916,6 +920,14 @@ struct JSRuntime : public js::MallocProvider<JSRuntime> {
     autoWritableJitCodeActive_ = b;
   }
 
+  js::jit::AutoWritableJitCodeBatch* jitCodeWriteBatch() {
+    return jitCodeWriteBatch_;
+  }
+  void setJitCodeWriteBatch(js::jit::AutoWritableJitCodeBatch* batch) {
+    MOZ_ASSERT(!batch != !jitCodeWriteBatch_);
+    jitCodeWriteBatch_ = batch;
+  }
+
   /* See comment for JS::SetOutOfMemoryCallback in jsapi.h. */
   js::MainThreadData<JS::OutOfMemoryCallback> oomCallback;
   js::MainThreadData<void*> oomCallbackData;
@@ -47,6 +47,7 @@
 #include "js/Modules.h"  // JS::GetModulePrivate
 #include "js/PropertySpec.h"
 #include "js/SourceText.h"  // JS::SourceText
+#include "js/Transcoding.h"  // JS::{Decode,Encode}Script, JS::SelfHostedCache
 #include "js/StableStringChars.h"
 #include "js/Warnings.h"  // JS::{,Set}WarningReporter
 #include "js/Wrapper.h"
@@ -3095,7 +3096,46 @@ static bool VerifyGlobalNames(JSContext* cx, Handle<GlobalObject*> shg) {
   return true;
 }
 
-bool JSRuntime::initSelfHosting(JSContext* cx) {
+static bool DecodeSelfHostedScript(JSContext* cx, JS::SelfHostedCache xdrCache,
+                                   MutableHandleScript script) {
+  JS::TranscodeRange range(const_cast<uint8_t*>(xdrCache.Elements()),
+                           xdrCache.Length());
+  JS::TranscodeResult result = JS::DecodeScript(cx, range, script);
+  if (result == JS::TranscodeResult_Ok) {
+    return true;
+  }
+
+  // A stale or corrupt cache is not fatal, we fall back to compiling the
+  // sources. An exception, on the other hand, is propagated.
+  script.set(nullptr);
+  return result != JS::TranscodeResult_Throw;
+}
+
+static JSScript* CompileSelfHostedScript(JSContext* cx) {
+  uint32_t srcLen = GetRawScriptsSize();
+
+  const unsigned char* compressed = compressedSources;
+  uint32_t compressedLen = GetCompressedSize();
+  auto src = cx->make_pod_array<char>(srcLen);
+  if (!src ||
+      !DecompressString(compressed, compressedLen,
+                        reinterpret_cast<unsigned char*>(src.get()), srcLen)) {
+    return nullptr;
+  }
+
+  CompileOptions options(cx);
+  FillSelfHostingCompileOptions(options);
+
+  JS::SourceText<mozilla::Utf8Unit> srcBuf;
+  if (!srcBuf.init(cx, std::move(src), srcLen)) {
+    return nullptr;
+  }
+
+  return JS::CompileDontInflate(cx, options, srcBuf);
+}
+
+bool JSRuntime::initSelfHosting(JSContext* cx, JS::SelfHostedCache xdrCache,
+                                JS::SelfHostedWriter xdrWriter) {
   MOZ_ASSERT(!selfHostingGlobal_);
 
   if (cx->runtime()->parentRuntime) {
@@ -3126,27 +3166,37 @@ bool JSRuntime::initSelfHosting(JSContext* cx) {
    */
   AutoSelfHostingErrorReporter errorReporter(cx);
 
-  uint32_t srcLen = GetRawScriptsSize();
-
-  const unsigned char* compressed = compressedSources;
-  uint32_t compressedLen = GetCompressedSize();
-  auto src = cx->make_pod_array<char>(srcLen);
-  if (!src ||
-      !DecompressString(compressed, compressedLen,
-                        reinterpret_cast<unsigned char*>(src.get()), srcLen)) {
-    return false;
+  // Decoding the script saves parsing and emitting bytecode for all of the
+  // self-hosted builtins.
+  RootedScript script(cx);
+  if (!xdrCache.IsEmpty()) {
+    if (!DecodeSelfHostedScript(cx, xdrCache, &script)) {
+      return false;
+    }
   }
 
-  CompileOptions options(cx);
-  FillSelfHostingCompileOptions(options);
+  if (!script) {
+    script = CompileSelfHostedScript(cx);
+    if (!script) {
+      return false;
+    }
 
-  JS::SourceText<mozilla::Utf8Unit> srcBuf;
-  if (!srcBuf.init(cx, std::move(src), srcLen)) {
-    return false;
+    if (xdrWriter) {
+      JS::TranscodeBuffer xdrBuffer;
+      JS::TranscodeResult result = JS::EncodeScript(cx, xdrBuffer, script);
+      if (result == JS::TranscodeResult_Throw) {
+        return false;
+      }
+      if (result == JS::TranscodeResult_Ok &&
+          !xdrWriter(cx, JS::SelfHostedCache(xdrBuffer.begin(),
+                                             xdrBuffer.length()))) {
+        return false;
+      }
+    }
   }
 
   RootedValue rv(cx);
-  if (!EvaluateDontInflate(cx, options, srcBuf, &rv)) {
+  if (!JS_ExecuteScript(cx, script, &rv)) {
     return false;
   }
 
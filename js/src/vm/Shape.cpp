@@ -156,14 +156,19 @@ void Shape::handoffTableTo(Shape* shape) {
 
 /* static */
 bool Shape::hashify(JSContext* cx, Shape* shape) {
+  return hashify(cx, shape, shape->entryCount());
+}
+
+/* static */
+bool Shape::hashify(JSContext* cx, Shape* shape, uint32_t entryCount) {
   MOZ_ASSERT(!shape->hasTable());
+  MOZ_ASSERT(entryCount == shape->entryCount());
 
   if (!shape->ensureOwnBaseShape(cx)) {
     return false;
   }
 
-  UniquePtr<ShapeTable> table =
-      cx->make_unique<ShapeTable>(shape->entryCount());
+  UniquePtr<ShapeTable> table = cx->make_unique<ShapeTable>(entryCount);
   if (!table) {
     return false;
   }
@@ -488,6 +493,7 @@ bool js::NativeObject::toDictionaryMode(JSContext* cx, HandleNativeObject obj) {
   RootedShape root(cx);
   RootedShape dictionaryShape(cx);
 
+  uint32_t entryCount = 0;
   RootedShape shape(cx, obj->lastProperty());
   while (shape) {
     MOZ_ASSERT(!shape->inDictionary());
@@ -509,10 +515,13 @@ bool js::NativeObject::toDictionaryMode(JSContext* cx, HandleNativeObject obj) {
 
     MOZ_ASSERT(!dprop->hasTable());
     dictionaryShape = dprop;
+    if (!shape->isEmptyShape()) {
+      entryCount++;
+    }
     shape = shape->previous();
   }
 
-  if (!Shape::hashify(cx, root)) {
+  if (!Shape::hashify(cx, root, entryCount)) {
     ReportOutOfMemory(cx);
     return false;
   }
@@ -979,8 +979,12 @@ class Shape : public gc::TenuredCell {
    * This function is thread safe if every shape in the lineage of |shape|
    * is thread local, which is the case when we clone the entire shape
    * lineage in preparation for converting an object to dictionary mode.
+   *
+   * The second overload is for callers that already know the number of
+   * entries in the lineage, which saves walking it to count them.
    */
   static bool hashify(JSContext* cx, Shape* shape);
+  static bool hashify(JSContext* cx, Shape* shape, uint32_t entryCount);
   static bool cachify(JSContext* cx, Shape* shape);
   void handoffTableTo(Shape* newShape);
 
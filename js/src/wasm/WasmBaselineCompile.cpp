@@ -6859,6 +6859,7 @@ class BaseCompiler final : public BaseCompilerInterface {
   MOZ_MUST_USE bool emitMemOrTableCopy(bool isMem);
   MOZ_MUST_USE bool emitDataOrElemDrop(bool isData);
   MOZ_MUST_USE bool emitMemFill();
+  MOZ_MUST_USE bool emitMemFillInline(uint32_t length);
   MOZ_MUST_USE bool emitMemOrTableInit(bool isMem);
 #endif
   MOZ_MUST_USE bool emitTableFill();
@@ -10265,10 +10266,53 @@ bool BaseCompiler::emitMemFill() {
     return true;
   }
 
+  // A zero length still requires a bounds check of the start, so leave that
+  // to the instance call.
+  int32_t len;
+  if (peekConstI32(&len) && len != 0 &&
+      uint32_t(len) <= MaxInlineMemFillLength) {
+    MOZ_ALWAYS_TRUE(popConstI32(&len));
+    return emitMemFillInline(uint32_t(len));
+  }
+
   return emitInstanceCall(lineOrBytecode, SASigMemFill,
                           /*pushReturnedValue=*/false);
 }
 
+// Expand memory.fill into byte stores, from the last byte down so that a fill
+// running past the end of memory traps before writing anything.  store() may
+// destroy its pointer and value registers, so each store gets fresh copies.
+bool BaseCompiler::emitMemFillInline(uint32_t length) {
+  MOZ_ASSERT(length != 0 && length <= MaxInlineMemFillLength);
+
+  RegI32 val = popI32();
+  int32_t startConst;
+  bool isConstStart = popConstI32(&startConst);
+  RegI32 start = isConstStart ? RegI32::Invalid() : popI32();
+
+  for (uint32_t offset = length; offset > 0; offset--) {
+    if (isConstStart) {
+      pushI32(startConst);
+    } else {
+      RegI32 ptr = needI32();
+      moveI32(start, ptr);
+      pushI32(ptr);
+    }
+    RegI32 byte = needI32();
+    moveI32(val, byte);
+    pushI32(byte);
+
+    MemoryAccessDesc access(Scalar::Int8, 1, offset - 1, bytecodeOffset());
+    if (!storeCommon(&access, ValType::I32)) {
+      return false;
+    }
+  }
+
+  maybeFreeI32(start);
+  freeI32(val);
+  return true;
+}
+
 bool BaseCompiler::emitMemOrTableInit(bool isMem) {
   uint32_t lineOrBytecode = readCallSiteLineOrBytecode();
 
@@ -84,6 +84,7 @@ ModuleGenerator::ModuleGenerator(const CompileArgs& args,
       parallel_(false),
       outstanding_(0),
       currentTask_(nullptr),
+      batchThreshold_(0),
       batchedBytecode_(0),
       finishedFuncDefs_(false) {
   MOZ_ASSERT(IsCompilingWasm());
@@ -433,6 +434,39 @@ bool ModuleGenerator::init(Metadata* maybeAsmJSMetadata) {
     freeTasks_.infallibleAppend(&tasks_[i]);
   }
 
+  // The batch thresholds are tuned for large modules. When compiling in
+  // parallel, shrink them so that even a small code section is split into
+  // several batches per compilation thread: otherwise a few large functions
+  // can end up in the same batch and stall the tail of compilation while the
+  // other threads sit idle. Don't shrink batches so far that per-task overhead
+  // starts to dominate.
+
+  switch (tier()) {
+    case Tier::Baseline:
+      batchThreshold_ = JitOptions.wasmBatchBaselineThreshold;
+      break;
+    case Tier::Optimized:
+      batchThreshold_ = JitOptions.wasmBatchIonThreshold;
+      break;
+    default:
+      MOZ_CRASH("Invalid tier value");
+      break;
+  }
+
+  // asm.js does not know its code size up front, so keep the default there.
+  if (parallel_ && env_->codeSection) {
+    static const uint32_t BatchesPerThread = 4;
+    static const uint32_t MinBatchThresholdDivisor = 8;
+
+    uint32_t codeSectionSize = env_->codeSection->size;
+    uint32_t numBatches =
+        BatchesPerThread * uint32_t(threads.maxWasmCompilationThreads());
+    uint32_t minThreshold =
+        Max(batchThreshold_ / MinBatchThresholdDivisor, uint32_t(1));
+    batchThreshold_ =
+        Min(batchThreshold_, Max(minThreshold, codeSectionSize / numBatches));
+  }
+
   // Fill in function stubs for each import so that imported functions can be
   // used in all the places that normal function definitions can (table
   // elements, export calls, etc).
@@ -853,19 +887,7 @@ bool ModuleGenerator::compileFuncDef(uint32_t funcIndex,
   MOZ_ASSERT(!finishedFuncDefs_);
   MOZ_ASSERT(funcIndex < env_->numFuncs());
 
-  uint32_t threshold;
-  switch (tier()) {
-    case Tier::Baseline:
-      threshold = JitOptions.wasmBatchBaselineThreshold;
-      break;
-    case Tier::Optimized:
-      threshold = JitOptions.wasmBatchIonThreshold;
-      break;
-    default:
-      MOZ_CRASH("Invalid tier value");
-      break;
-  }
-
+  uint32_t threshold = batchThreshold_;
   uint32_t funcBytecodeLength = end - begin;
 
   // Do not go over the threshold if we can avoid it: spin off the compilation
@@ -895,6 +917,15 @@ bool ModuleGenerator::compileFuncDef(uint32_t funcIndex,
 
   batchedBytecode_ += funcBytecodeLength;
   MOZ_ASSERT(batchedBytecode_ <= MaxCodeSectionBytes);
+
+  // Once the batch is full, start compiling it right away rather than waiting
+  // for the next function to arrive. When streaming, the next function may be
+  // a long way off, and a single function at or over the threshold should get
+  // a helper thread to itself as early as possible.
+  if (batchedBytecode_ >= threshold) {
+    return launchBatchCompile();
+  }
+
   return true;
 }
 
@@ -177,6 +177,7 @@ class MOZ_STACK_CLASS ModuleGenerator {
   CompileTaskVector tasks_;
   CompileTaskPtrVector freeTasks_;
   CompileTask* currentTask_;
+  uint32_t batchThreshold_;
   uint32_t batchedBytecode_;
 
   // Assertions
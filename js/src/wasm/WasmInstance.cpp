@@ -452,39 +452,16 @@ static int32_t PerformWait(Instance* instance, uint32_t byteOffset, T value,
     }
   } else {
     // Here, we know that |len - 1| cannot underflow.
-    bool mustTrap = false;
 
-    // As we're supposed to write data until we trap we have to deal with
-    // arithmetic overflow in the limit calculation.
+    // Both ranges are checked before anything is copied, so a copy that would
+    // read or write past the end traps without modifying memory, like
+    // memory.fill and memory.init.
     uint64_t highestDstOffset = uint64_t(dstByteOffset) + uint64_t(len - 1);
     uint64_t highestSrcOffset = uint64_t(srcByteOffset) + uint64_t(len - 1);
-
-    bool copyDown =
-        srcByteOffset < dstByteOffset && dstByteOffset < highestSrcOffset;
-
-    if (highestDstOffset >= memLen || highestSrcOffset >= memLen) {
-      // We would read past the end of the source or write past the end of the
-      // target.
-      if (copyDown) {
-        // We would trap on the first read or write, so don't read or write
-        // anything.
-        len = 0;
-      } else {
-        // Compute what we have space for in target and what's available in the
-        // source and pick the lowest value as the new len.
-        uint64_t srcAvail = memLen < srcByteOffset ? 0 : memLen - srcByteOffset;
-        uint64_t dstAvail = memLen < dstByteOffset ? 0 : memLen - dstByteOffset;
-        MOZ_ASSERT(len > Min(srcAvail, dstAvail));
-        len = uint32_t(Min(srcAvail, dstAvail));
-      }
-      mustTrap = true;
-    }
-
-    if (len > 0) {
-      // The required write direction is indicated by `copyDown`, but apart from
-      // the trap that may happen without writing anything, the direction is not
-      // currently observable as there are no fences nor any read/write protect
-      // operation.  So memmove is good enough to handle overlaps.
+    if (highestDstOffset < memLen && highestSrcOffset < memLen) {
+      // The copy direction is not observable as there are no fences nor any
+      // read/write protect operation.  So memmove is good enough to handle
+      // overlaps.
       SharedMem<uint8_t*> dataPtr = mem->buffer().dataPointerEither();
       if (mem->isShared()) {
         AtomicOperations::memmoveSafeWhenRacy(
@@ -493,9 +470,6 @@ static int32_t PerformWait(Instance* instance, uint32_t byteOffset, T value,
         uint8_t* rawBuf = dataPtr.unwrap(/*Unshared*/);
         memmove(rawBuf + dstByteOffset, rawBuf + srcByteOffset, size_t(len));
       }
-    }
-
-    if (!mustTrap) {
       return 0;
     }
   }
@@ -542,21 +516,12 @@ static int32_t PerformWait(Instance* instance, uint32_t byteOffset, T value,
   } else {
     // Here, we know that |len - 1| cannot underflow.
 
-    bool mustTrap = false;
-
-    // We must write data until we trap, so we have to deal with arithmetic
-    // overflow in the limit calculation.
+    // The whole range is checked before anything is written, so a fill that
+    // would run past the end traps without modifying memory, like memory.copy
+    // and memory.init.  Inline expansions of memory.fill in the compilers
+    // depend on this.
     uint64_t highestOffset = uint64_t(byteOffset) + uint64_t(len - 1);
-    if (highestOffset >= memLen) {
-      // We would write past the end.  Compute what we have space for in the
-      // target and make that the new len.
-      uint64_t avail = memLen < byteOffset ? 0 : memLen - byteOffset;
-      MOZ_ASSERT(len > avail);
-      len = uint32_t(avail);
-      mustTrap = true;
-    }
-
-    if (len > 0) {
+    if (highestOffset < memLen) {
       // The required write direction is upward, but that is not currently
       // observable as there are no fences nor any read/write protect operation.
       SharedMem<uint8_t*> dataPtr = mem->buffer().dataPointerEither();
@@ -567,9 +532,6 @@ static int32_t PerformWait(Instance* instance, uint32_t byteOffset, T value,
         uint8_t* rawBuf = dataPtr.unwrap(/*Unshared*/);
         memset(rawBuf + byteOffset, int(value), size_t(len));
       }
-    }
-
-    if (!mustTrap) {
       return 0;
     }
   }
@@ -618,25 +580,12 @@ static int32_t PerformWait(Instance* instance, uint32_t byteOffset, T value,
   } else {
     // Here, we know that |len - 1| cannot underflow.
 
-    bool mustTrap = false;
-
-    // As we're supposed to write data until we trap we have to deal with
-    // arithmetic overflow in the limit calculation.
+    // Both ranges are checked before anything is copied, so an init that would
+    // read past the end of the segment or write past the end of memory traps
+    // without modifying memory, like memory.fill and memory.copy.
     uint64_t highestDstOffset = uint64_t(dstOffset) + uint64_t(len - 1);
     uint64_t highestSrcOffset = uint64_t(srcOffset) + uint64_t(len - 1);
-
-    if (highestDstOffset >= memLen || highestSrcOffset >= segLen) {
-      // We would read past the end of the source or write past the end of the
-      // target.  Compute what we have space for in target and what's available
-      // in the source and pick the lowest value as the new len.
-      uint64_t srcAvail = segLen < srcOffset ? 0 : segLen - srcOffset;
-      uint64_t dstAvail = memLen < dstOffset ? 0 : memLen - dstOffset;
-      MOZ_ASSERT(len > Min(srcAvail, dstAvail));
-      len = uint32_t(Min(srcAvail, dstAvail));
-      mustTrap = true;
-    }
-
-    if (len > 0) {
+    if (highestDstOffset < memLen && highestSrcOffset < segLen) {
       // The required read/write direction is upward, but that is not currently
       // observable as there are no fences nor any read/write protect operation.
       SharedMem<uint8_t*> dataPtr = mem->buffer().dataPointerEither();
@@ -648,9 +597,6 @@ static int32_t PerformWait(Instance* instance, uint32_t byteOffset, T value,
         memcpy(rawBuf + dstOffset, (const char*)seg.bytes.begin() + srcOffset,
                len);
       }
-    }
-
-    if (!mustTrap) {
       return 0;
     }
   }
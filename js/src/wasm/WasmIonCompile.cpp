@@ -2949,6 +2949,22 @@ static bool EmitDataOrElemDrop(FunctionCompiler& f, bool isData) {
   return f.builtinInstanceMethodCall(callee, lineOrBytecode, args);
 }
 
+// memory.fill with a small constant length is expanded inline into byte
+// stores, avoiding the instance call. A fill that runs past the end of memory
+// must trap before writing anything, so the last byte is stored first: if it
+// is in bounds then so is every byte before it. Where the platform needs
+// explicit bounds checks, each store gets one, but with offsets folded into
+// the accesses they all check the same base and WasmBCE keeps only the first.
+static void EmitMemFillInline(FunctionCompiler& f, MDefinition* start,
+                              MDefinition* val, uint32_t length) {
+  MOZ_ASSERT(length != 0 && length <= MaxInlineMemFillLength);
+
+  for (uint32_t offset = length; offset > 0; offset--) {
+    MemoryAccessDesc access(Scalar::Int8, 1, offset - 1, f.bytecodeOffset());
+    f.store(start, &access, val);
+  }
+}
+
 static bool EmitMemFill(FunctionCompiler& f) {
   MDefinition *start, *val, *len;
   if (!f.iter().readMemFill(&start, &val, &len)) {
@@ -2959,6 +2975,16 @@ static bool EmitMemFill(FunctionCompiler& f) {
     return true;
   }
 
+  // A zero length still requires a bounds check of 'start', so leave that to
+  // the instance call.
+  if (len->isConstant()) {
+    uint32_t length = uint32_t(len->toConstant()->toInt32());
+    if (length != 0 && length <= MaxInlineMemFillLength) {
+      EmitMemFillInline(f, start, val, length);
+      return true;
+    }
+  }
+
   uint32_t lineOrBytecode = f.readCallSiteLineOrBytecode();
 
   const SymbolicAddressSignature& callee = SASigMemFill;
@@ -2281,6 +2281,13 @@ static const unsigned PageSize = 64 * 1024;
 
 static const unsigned MaxMemoryAccessSize = LitVal::sizeofLargestValue();
 
+// memory.fill with a constant, nonzero length of at most this many bytes is
+// expanded by the compilers into byte stores instead of calling
+// Instance::memFill.  The last byte is stored first, so that a fill running
+// past the end of memory traps before writing anything.
+
+static const uint32_t MaxInlineMemFillLength = 16;
+
 #ifdef WASM_HUGE_MEMORY
 
 // On WASM_HUGE_MEMORY platforms, every asm.js or WebAssembly memory
@@ -843,11 +843,17 @@ nsresult mozJSComponentLoader::ObjectForLocation(
     // fast. When we're not using the startup cache, we want to use non-lazy
     // source code so that we can use lazy parsing.
     // See bug 1303754.
+    //
+    // Inner functions are still lazily parsed with lazy source. They stay
+    // lazy in the XDR encoding, so functions which never run are neither
+    // decoded nor compiled; the ones which do run get their source back from
+    // the XPCJSSourceHook.
     CompileOptions options(cx);
     options.setNoScriptRval(true)
         .maybeMakeStrictMode(true)
         .setFileAndLine(nativePath.get(), 1)
-        .setSourceIsLazy(cache || ScriptPreloader::GetSingleton().Active());
+        .setSourceIsLazy(cache || ScriptPreloader::GetSingleton().Active())
+        .setLazilyParseLazySource(true);
 
     if (realFile) {
       AutoMemMap map;
@@ -3972,6 +3972,11 @@ nsresult nsLayoutUtils::PaintFrame(gfxContext* aRenderingContext,
         }
 
         metrics->EndPartialBuild(updateState);
+        if (updateState == PartialUpdateResult::Failed) {
+          Telemetry::Accumulate(
+              Telemetry::PAINT_PARTIAL_DISPLAYLIST_FAIL_REASON,
+              static_cast<uint32_t>(metrics->mPartialUpdateFailReason));
+        }
       } else {
         // Partial updates are disabled.
         metrics->mPartialUpdateResult = PartialUpdateResult::Failed;
@@ -5470,6 +5475,13 @@ nscoord nsLayoutUtils::IntrinsicForAxis(
           horizontalAxis ? intrinsicSize.width : intrinsicSize.height;
       if (intrinsicBSize) {
         result = *intrinsicBSize;
+      } else if (aFrame->StyleDisplay()->IsContainSize() &&
+                 !aFrame->IsFrameOfType(nsIFrame::eLineParticipant)) {
+        // A size-contained box is sized as if it had no contents, so its
+        // content-box bsize is zero and we don't need to reflow it to find
+        // out.  This lets e.g. grid track sizing skip the measuring reflows
+        // of size-contained items' (possibly large) subtrees.
+        result = 0;
       } else {
         // We don't have an intrinsic bsize and we need aFrame's block-dir size.
         if (aFlags & BAIL_IF_REFLOW_NEEDED) {
@@ -547,6 +547,11 @@ class nsFlexContainerFrame::FlexItem : public LinkedListElement<FlexItem> {
   // before its actual reflow.
   bool HadMeasuringReflow() const { return mHadMeasuringReflow; }
 
+  // Indicates whether this item's measurement (and ascent) came from a
+  // CachedFlexMeasuringReflow result that was valid for this reflow's input,
+  // in place of a measuring reflow.
+  bool UsedCachedMeasurement() const { return mUsedCachedMeasurement; }
+
   // Indicates whether this item's computed cross-size property is 'auto'.
   bool IsCrossSizeAuto() const;
 
@@ -812,6 +817,8 @@ class nsFlexContainerFrame::FlexItem : public LinkedListElement<FlexItem> {
 
   void SetHadMeasuringReflow() { mHadMeasuringReflow = true; }
 
+  void SetUsedCachedMeasurement() { mUsedCachedMeasurement = true; }
+
   void SetIsStretched() {
     MOZ_ASSERT(mIsFrozen, "main size should be resolved before this");
     mIsStretched = true;
@@ -883,6 +890,7 @@ class nsFlexContainerFrame::FlexItem : public LinkedListElement<FlexItem> {
   // Misc:
   bool mHadMeasuringReflow;  // Did this item get a preliminary reflow,
                              // to measure its desired height?
+  bool mUsedCachedMeasurement;  // See UsedCachedMeasurement() documentation
   bool mIsStretched;         // See IsStretched() documentation
   bool mIsStrut;             // Is this item a "strut" left behind by an element
                              // with visibility:collapse?
@@ -1788,6 +1796,7 @@ nsFlexContainerFrame::MeasureAscentAndBSizeForFlexItem(
   if (const auto* cachedResult =
           aItem.Frame()->GetProperty(CachedFlexMeasuringReflow())) {
     if (cachedResult->IsValidFor(aChildReflowInput)) {
+      aItem.SetUsedCachedMeasurement();
       return *cachedResult;
     }
     MOZ_LOG(gFlexContainerLog, LogLevel::Debug,
@@ -1901,6 +1910,7 @@ FlexItem::FlexItem(ReflowInput& aFlexItemReflowInput, float aFlexGrow,
       mHadMinViolation(false),
       mHadMaxViolation(false),
       mHadMeasuringReflow(false),
+      mUsedCachedMeasurement(false),
       mIsStretched(false),
       mIsStrut(false),
       mIsInlineAxisMainAxis(aAxisTracker.IsRowOriented() !=
@@ -2006,6 +2016,7 @@ FlexItem::FlexItem(nsIFrame* aChildFrame, nscoord aCrossSize,
       mHadMinViolation(false),
       mHadMaxViolation(false),
       mHadMeasuringReflow(false),
+      mUsedCachedMeasurement(false),
       mIsStretched(false),
       mIsStrut(true),  // (this is the constructor for making struts, after all)
       mIsInlineAxisMainAxis(true),  // (doesn't matter, we're not doing layout)
@@ -4880,8 +4891,21 @@ void nsFlexContainerFrame::DoFlexLayout(
       // Check if we actually need to reflow the item -- if we already reflowed
       // it with the right size, and there is no need to do a reflow to clear
       // out a -webkit-line-clamp ellipsis, we can just reposition it as-needed.
+      //
+      // The same holds if this item's measurement came from a cached measuring
+      // reflow result that matched this reflow's input (which also gave us its
+      // ascent) and nothing in its subtree has been dirtied since its last
+      // reflow: its frames still reflect that last layout, so if its size
+      // hasn't changed then reflowing it again would be redundant. Skipping
+      // that keeps relayout of nested flex containers from walking every
+      // unchanged descendant. Items that needed no measurement at all don't
+      // qualify, since only ReflowFlexItem would set their ascent.
       bool itemNeedsReflow = true;  // (Start out assuming the worst.)
-      if (item->HadMeasuringReflow()) {
+      const bool itemLayoutIsCurrent =
+          item->HadMeasuringReflow() ||
+          (item->UsedCachedMeasurement() && !NS_SUBTREE_DIRTY(item->Frame()) &&
+           GetLineClampValue() == 0 && !aHasLineClampEllipsis);
+      if (itemLayoutIsCurrent) {
         LogicalSize finalFlexItemCBSize =
             aAxisTracker.LogicalSizeFromFlexRelativeSizes(item->GetMainSize(),
                                                           item->GetCrossSize());
@@ -4903,7 +4927,7 @@ void nsFlexContainerFrame::DoFlexLayout(
                                         containerSize);
           }
         }
-        if (itemNeedsReflow) {
+        if (itemNeedsReflow && item->HadMeasuringReflow()) {
           MOZ_LOG(gFlexContainerLog, LogLevel::Debug,
                   ("[perf] Flex item needed both a measuring reflow and "
                    "a final reflow\n"));
@@ -5215,6 +5215,28 @@ void nsGridContainerFrame::Tracks::ResolveIntrinsicSize(
   // http://dev.w3.org/csswg/css-grid/#algo-content
   // We're also setting eIsFlexing on the item state here to speed up
   // FindUsedFlexFraction later.
+  if (!(mStateUnion &
+        (TrackSize::eIntrinsicMinSizing | TrackSize::eIntrinsicMaxSizing))) {
+    // Fast path: no track in this axis has an intrinsic sizing function, so
+    // no item contributes to any track size.  We just need to mark the items
+    // that span a flexible track, and run Step 3.
+    if (mStateUnion & TrackSize::eFlexMaxSizing) {
+      for (auto& gridItem : aGridItems) {
+        if (!(gridItem.mState[mAxis] & ItemState::eIsSubgrid) &&
+            (StateBitsForRange(gridItem.mArea.*aRange) &
+             TrackSize::eFlexMaxSizing)) {
+          gridItem.mState[mAxis] |= ItemState::eIsFlexing;
+        }
+      }
+    }
+    for (TrackSize& sz : mSizes) {
+      if (sz.mLimit == NS_UNCONSTRAINEDSIZE) {
+        sz.mLimit = sz.mBase;
+      }
+    }
+    return;
+  }
+
   struct PerSpanData {
     PerSpanData()
         : mItemCountWithSameSpan(0), mStateBits(TrackSize::StateBits(0)) {}
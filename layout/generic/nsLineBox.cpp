@@ -21,6 +21,8 @@
 #include "nsPrintfCString.h"
 #include "nsWindowSizes.h"
 
+#include <algorithm>
+
 #ifdef DEBUG
 static int32_t ctorCount;
 int32_t nsLineBox::GetCtorCount() { return ctorCount; }
@@ -615,6 +617,43 @@ nsLineIterator::GetLine(int32_t aLineNumber, nsIFrame** aFirstFrameOnLine,
 int32_t nsLineIterator::FindLineContaining(nsIFrame* aFrame,
                                            int32_t aStartLine) {
   MOZ_ASSERT(aStartLine <= mNumLines, "Bogus line numbers");
+
+  // For long line lists, first guess the line from aFrame's block-direction
+  // position: line bstarts are (almost always) non-decreasing, so a binary
+  // search lands on or next to the right line.  Negative margins, relative
+  // positioning and the like can defeat the guess, in which case we fall
+  // back to the linear search below.
+  static const int32_t kMinLinesForBinarySearch = 32;
+  if (mNumLines - aStartLine >= kMinLinesForBinarySearch &&
+      mLines[aStartLine]->mFirstChild &&
+      aFrame->GetParent() == mLines[aStartLine]->mFirstChild->GetParent()) {
+    const nsLineBox* firstLine = mLines[aStartLine];
+    const WritingMode wm = firstLine->mWritingMode;
+    const nsSize containerSize = firstLine->mContainerSize;
+    if (containerSize != nsSize(-1, -1)) {
+      const nscoord bStart =
+          LogicalRect(wm, aFrame->GetNormalRect(), containerSize).BStart(wm);
+      // Find the last line starting at or before bStart.
+      int32_t low = aStartLine;
+      int32_t high = mNumLines;
+      while (high - low > 1) {
+        int32_t mid = low + (high - low) / 2;
+        if (mLines[mid]->BStart() <= bStart) {
+          low = mid;
+        } else {
+          high = mid;
+        }
+      }
+      for (int32_t lineNumber = std::max(low - 1, aStartLine),
+                   end = std::min(low + 2, mNumLines);
+           lineNumber < end; ++lineNumber) {
+        if (mLines[lineNumber]->Contains(aFrame)) {
+          return lineNumber;
+        }
+      }
+    }
+  }
+
   int32_t lineNumber = aStartLine;
   while (lineNumber != mNumLines) {
     nsLineBox* line = mLines[lineNumber];
@@ -14,6 +14,7 @@
 #include "nsUnicharUtils.h"
 #include "nsUnicodeProperties.h"
 #include <algorithm>
+#include <string.h>
 
 using namespace mozilla;
 
@@ -197,8 +198,36 @@ CharT* nsTextFrameUtils::TransformText(const CharT* aText, uint32_t aLength,
 #endif
 
   bool lastCharArabic = false;
-  if (aCompression == COMPRESS_NONE ||
-      aCompression == COMPRESS_NONE_TRANSFORM_TO_SPACE) {
+  if (sizeof(CharT) == 1 && aCompression == COMPRESS_NONE) {
+    // Fast path for preformatted 8-bit text (e.g. logs and source code): the
+    // only discardable character is the soft hyphen, so copy the runs between
+    // them wholesale rather than character by character.  No 8-bit character
+    // is Arabic, so lastCharArabic stays false.
+    const CharT* const end = aText + aLength;
+    const CharT* runStart = aText;
+    while (runStart < end) {
+      const CharT* shy =
+          static_cast<const CharT*>(memchr(runStart, CH_SHY, end - runStart));
+      const CharT* runEnd = shy ? shy : end;
+      uint32_t runLength = runEnd - runStart;
+      if (runLength) {
+        memcpy(aOutput, runStart, runLength * sizeof(CharT));
+        aOutput += runLength;
+        aSkipChars->KeepChars(runLength);
+      }
+      if (!shy) {
+        break;
+      }
+      flags |= Flags::HasShy;
+      aSkipChars->SkipChar();
+      runStart = shy + 1;
+    }
+    if (memchr(aText, '\t', aLength)) {
+      flags |= Flags::HasTab;
+    }
+    *aIncomingFlags &= ~(INCOMING_ARABICCHAR | INCOMING_WHITESPACE);
+  } else if (aCompression == COMPRESS_NONE ||
+             aCompression == COMPRESS_NONE_TRANSFORM_TO_SPACE) {
     // Skip discardables.
     uint32_t i;
     for (i = 0; i < aLength; ++i) {
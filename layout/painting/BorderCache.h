@@ -8,6 +8,7 @@
 #define mozilla_BorderCache_h_
 
 #include "mozilla/gfx/2D.h"
+#include "mozilla/gfx/BezierUtils.h"
 #include "mozilla/HashFunctions.h"
 #include "nsDataHashtable.h"
 #include "PLDHashTable.h"
@@ -63,6 +64,73 @@ class FourFloatsHashKey : public PLDHashEntryHdr {
   const FourFloats mValue;
 };
 
+// Key for the cache of the dots computed for a dotted corner. It holds every
+// input of DottedCornerFinder, with all the positions taken relative to the
+// outer corner of the border, so corners with the same geometry share an
+// entry wherever they are drawn.
+struct DottedCornerKey {
+  typedef mozilla::gfx::Bezier Bezier;
+  typedef mozilla::gfx::Float Float;
+  typedef mozilla::gfx::Point Point;
+  typedef mozilla::gfx::Size Size;
+
+  static const size_t Length = 26;
+
+  // The outer and inner Bezier curves, C0, Cn, R0, Rn, the radius and the
+  // corner dimensions.
+  Float n[Length];
+  uint32_t mCorner;
+
+  DottedCornerKey(mozilla::Corner aCorner, const Bezier& aOuter,
+                  const Bezier& aInner, const Point& aC0, const Point& aCn,
+                  Float aR0, Float aRn, const Size& aRadius,
+                  const Size& aCornerDim)
+      : n{aOuter.mPoints[0].x, aOuter.mPoints[0].y, aOuter.mPoints[1].x,
+          aOuter.mPoints[1].y, aOuter.mPoints[2].x, aOuter.mPoints[2].y,
+          aOuter.mPoints[3].x, aOuter.mPoints[3].y, aInner.mPoints[0].x,
+          aInner.mPoints[0].y, aInner.mPoints[1].x, aInner.mPoints[1].y,
+          aInner.mPoints[2].x, aInner.mPoints[2].y, aInner.mPoints[3].x,
+          aInner.mPoints[3].y, aC0.x, aC0.y, aCn.x, aCn.y, aR0, aRn,
+          aRadius.width, aRadius.height, aCornerDim.width, aCornerDim.height},
+        mCorner(aCorner) {}
+
+  bool operator==(const DottedCornerKey& aOther) const {
+    if (mCorner != aOther.mCorner) {
+      return false;
+    }
+    for (size_t i = 0; i < Length; i++) {
+      if (n[i] != aOther.n[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+class DottedCornerKeyHashKey : public PLDHashEntryHdr {
+ public:
+  typedef const DottedCornerKey& KeyType;
+  typedef const DottedCornerKey* KeyTypePointer;
+
+  explicit DottedCornerKeyHashKey(KeyTypePointer aKey) : mValue(*aKey) {}
+  DottedCornerKeyHashKey(const DottedCornerKeyHashKey& aToCopy)
+      : mValue(aToCopy.mValue) {}
+  ~DottedCornerKeyHashKey() = default;
+
+  KeyType GetKey() const { return mValue; }
+  bool KeyEquals(KeyTypePointer aKey) const { return *aKey == mValue; }
+
+  static KeyTypePointer KeyToPointer(KeyType aKey) { return &aKey; }
+  static PLDHashNumber HashKey(KeyTypePointer aKey) {
+    return AddToHash(HashBytes(aKey->n, sizeof(aKey->n)),
+                     aKey->mCorner);
+  }
+  enum { ALLOW_MEMMOVE = true };
+
+ private:
+  const DottedCornerKey mValue;
+};
+
 }  // namespace mozilla
 
 #endif /* mozilla_BorderCache_h_ */
@@ -157,6 +157,8 @@ bool RetainedDisplayListBuilder::PreProcessDisplayList(
   if (!aKeepLinked && !initializeDAG &&
       aList->mDAG.mDirectPredecessorList.Length() >
           (aList->mDAG.mNodesInfo.Length() * kMaxEdgeRatio)) {
+    Metrics()->mPartialUpdateFailReason =
+        PartialUpdateFailReason::DAGComplexity;
     return false;
   }
 
@@ -1203,6 +1205,8 @@ bool RetainedDisplayListBuilder::ProcessFrame(
 
   if (!ProcessFrameInternal(aFrame, aBuilder, &agr, overflow, aStopAtFrame,
                             aOutFramesWithProps, aStopAtStackingContext)) {
+    // ProcessFrameInternal only gives up on frames in a preserve-3d context.
+    Metrics()->mPartialUpdateFailReason = PartialUpdateFailReason::Preserve3D;
     return false;
   }
 
@@ -1219,6 +1223,8 @@ bool RetainedDisplayListBuilder::ProcessFrame(
       *aOutModifiedAGR = agr;
     } else if (agr && *aOutModifiedAGR != agr) {
       CRR_LOG("Found multiple AGRs in root stacking context, giving up\n");
+      Metrics()->mPartialUpdateFailReason =
+          PartialUpdateFailReason::MultipleAGRs;
       return false;
     }
   }
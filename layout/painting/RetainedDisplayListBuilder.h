@@ -95,6 +95,8 @@ RetainedDisplayListData* GetOrSetRetainedDisplayListData(nsIFrame* aRootFrame);
 
 enum class PartialUpdateResult { Failed, NoChange, Updated };
 
+// Keep in sync with the labels of the PAINT_PARTIAL_DISPLAYLIST_FAIL_REASON
+// histogram.
 enum class PartialUpdateFailReason {
   NA,
   EmptyList,
@@ -103,6 +105,9 @@ enum class PartialUpdateFailReason {
   Disabled,
   Content,
   VisibleRect,
+  MultipleAGRs,
+  Preserve3D,
+  DAGComplexity,
 };
 
 struct RetainedDisplayListMetrics {
@@ -149,6 +154,12 @@ struct RetainedDisplayListMetrics {
         return "Content";
       case PartialUpdateFailReason::VisibleRect:
         return "VisibleRect";
+      case PartialUpdateFailReason::MultipleAGRs:
+        return "Multiple AGRs";
+      case PartialUpdateFailReason::Preserve3D:
+        return "Preserve 3D";
+      case PartialUpdateFailReason::DAGComplexity:
+        return "DAG complexity";
       default:
         MOZ_ASSERT_UNREACHABLE("Enum value not handled!");
     }
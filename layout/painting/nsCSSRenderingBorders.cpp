@@ -8,9 +8,11 @@
 
 #include "gfxUtils.h"
 #include "mozilla/ArrayUtils.h"
+#include "mozilla/ClearOnShutdown.h"
 #include "mozilla/gfx/2D.h"
 #include "mozilla/gfx/Helpers.h"
 #include "mozilla/gfx/PathHelpers.h"
+#include "BorderCache.h"
 #include "BorderConsts.h"
 #include "DashedCornerFinder.h"
 #include "DottedCornerFinder.h"
@@ -33,6 +35,7 @@
 #include "mozilla/layers/RenderRootStateManager.h"
 #include "mozilla/layers/WebRenderLayerManager.h"
 #include "mozilla/Range.h"
+#include "mozilla/StaticPtr.h"
 #include <algorithm>
 
 using namespace mozilla;
@@ -2311,6 +2314,14 @@ void nsCSSBorderRenderer::DrawDashedOrDottedCorner(mozilla::Side aSide,
                       strokeOptions);
 }
 
+// Dots computed by DottedCornerFinder, relative to the outer corner of the
+// border. Lists of elements with the same dotted rounded border would
+// otherwise run the finder again for every corner of every element.
+typedef nsTArray<DottedCornerFinder::Result> DottedCornerDots;
+static const size_t DottedCornerDotsCacheSize = 256;
+static StaticAutoPtr<nsClassHashtable<DottedCornerKeyHashKey, DottedCornerDots>>
+    sDottedCornerDotsCache;
+
 void nsCSSBorderRenderer::DrawDottedCornerSlow(mozilla::Side aSide,
                                                Corner aCorner) {
   NS_ASSERTION(mBorderStyles[aSide] == StyleBorderStyle::Dotted,
@@ -2325,17 +2336,45 @@ void nsCSSBorderRenderer::DrawDottedCornerSlow(mozilla::Side aSide,
   }
 
   nscolor borderColor = mBorderColors[aSide];
+
+  // The finder always runs on geometry relative to the outer corner, whether
+  // or not the result ends up cached, so that a cache hit draws exactly the
+  // dots a miss would have.
+  Point origin = mOuterRect.AtCorner(aCorner);
   Bezier outerBezier;
   Bezier innerBezier;
   GetOuterAndInnerBezier(&outerBezier, &innerBezier, aCorner);
+  for (size_t i = 0; i < 4; i++) {
+    outerBezier.mPoints[i] -= origin;
+    innerBezier.mPoints[i] -= origin;
+  }
 
   bool ignored;
-  Point C0 = GetStraightBorderPoint(sideH, aCorner, &ignored);
-  Point Cn = GetStraightBorderPoint(sideV, aCorner, &ignored);
-  DottedCornerFinder finder(outerBezier, innerBezier, aCorner,
-                            mBorderRadii[aCorner].width,
-                            mBorderRadii[aCorner].height, C0, R0, Cn, Rn,
-                            mBorderCornerDimensions[aCorner]);
+  Point C0 = GetStraightBorderPoint(sideH, aCorner, &ignored) - origin;
+  Point Cn = GetStraightBorderPoint(sideV, aCorner, &ignored) - origin;
+
+  if (!sDottedCornerDotsCache) {
+    sDottedCornerDotsCache =
+        new nsClassHashtable<DottedCornerKeyHashKey, DottedCornerDots>();
+    ClearOnShutdown(&sDottedCornerDotsCache);
+  }
+
+  DottedCornerKey key(aCorner, outerBezier, innerBezier, C0, Cn, R0, Rn,
+                      mBorderRadii[aCorner], mBorderCornerDimensions[aCorner]);
+  DottedCornerDots* dots = sDottedCornerDotsCache->Get(key);
+  if (!dots) {
+    DottedCornerFinder finder(outerBezier, innerBezier, aCorner,
+                              mBorderRadii[aCorner].width,
+                              mBorderRadii[aCorner].height, C0, R0, Cn, Rn,
+                              mBorderCornerDimensions[aCorner]);
+    if (sDottedCornerDotsCache->Count() > DottedCornerDotsCacheSize) {
+      sDottedCornerDotsCache->Clear();
+    }
+    dots = sDottedCornerDotsCache->LookupOrAdd(key);
+    while (finder.HasMore()) {
+      dots->AppendElement(finder.Next());
+    }
+  }
 
   RefPtr<PathBuilder> builder = mDrawTarget->CreatePathBuilder();
   size_t segmentCount = 0;
@@ -2343,7 +2382,7 @@ void nsCSSBorderRenderer::DrawDottedCornerSlow(mozilla::Side aSide,
   Rect marginedDirtyRect = mDirtyRect;
   marginedDirtyRect.Inflate(std::max(R0, Rn) + AA_MARGIN);
   bool entered = false;
-  while (finder.HasMore()) {
+  for (DottedCornerFinder::Result result : *dots) {
     if (segmentCount > BORDER_SEGMENT_COUNT_MAX) {
       RefPtr<Path> path = builder->Finish();
       mDrawTarget->Fill(path, ColorPattern(ToDeviceColor(borderColor)));
@@ -2351,7 +2390,7 @@ void nsCSSBorderRenderer::DrawDottedCornerSlow(mozilla::Side aSide,
       segmentCount = 0;
     }
 
-    DottedCornerFinder::Result result = finder.Next();
+    result.C += origin;
 
     if (marginedDirtyRect.Contains(result.C) && result.r > 0) {
       entered = true;
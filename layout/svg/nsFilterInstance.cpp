@@ -114,6 +114,32 @@ static mozilla::wr::ComponentTransferFuncType FuncTypeToWr(uint8_t aFuncType) {
   return mozilla::wr::ComponentTransferFuncType::Identity;
 }
 
+// Returns true if every channel of the component transfer leaves its input
+// unchanged, in which case there's no point asking WebRender to run it.
+static bool IsIdentityComponentTransfer(
+    const ComponentTransferAttributes& aAttributes) {
+  for (uint32_t i = 0; i < 4; i++) {
+    const nsTArray<float>& values = aAttributes.mValues[i];
+    switch (aAttributes.mTypes[i]) {
+      case SVG_FECOMPONENTTRANSFER_TYPE_IDENTITY:
+        break;
+      case SVG_FECOMPONENTTRANSFER_TYPE_TABLE:
+        if (values.Length() >= 2) {
+          return false;
+        }
+        break;
+      case SVG_FECOMPONENTTRANSFER_TYPE_DISCRETE:
+        if (values.Length() >= 1) {
+          return false;
+        }
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
 bool nsFilterInstance::BuildWebRenderFilters(nsIFrame* aFilteredFrame,
                                              WrFiltersHolder& aWrFilters,
                                              Maybe<nsRect>& aPostFilterClip) {
@@ -277,6 +303,10 @@ bool nsFilterInstance::BuildWebRenderFilters(nsIFrame* aFilteredFrame,
       wr::FilterOp filterOp = wr::FilterOp::DropShadow(wrShadow);
 
       aWrFilters.filters.AppendElement(filterOp);
+    } else if (attr.is<ComponentTransferAttributes>() &&
+               IsIdentityComponentTransfer(
+                   attr.as<ComponentTransferAttributes>())) {
+      filterIsNoop = true;
     } else if (attr.is<ComponentTransferAttributes>()) {
       const ComponentTransferAttributes& attributes =
           attr.as<ComponentTransferAttributes>();
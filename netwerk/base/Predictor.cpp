@@ -23,6 +23,7 @@
 #include "nsILoadContext.h"
 #include "nsILoadContextInfo.h"
 #include "nsILoadGroup.h"
+#include "nsINetworkLinkService.h"
 #include "nsINetworkPredictorVerifier.h"
 #include "nsIObserverService.h"
 #include "nsIPrefBranch.h"
@@ -1294,6 +1295,29 @@ nsresult Predictor::Prefetch(nsIURI* uri, nsIURI* referrer,
   return rv;
 }
 
+// Prefetching spends real bandwidth on guesses, so only do it on links that
+// are unlikely to be metered. This matches the links race-cache-with-network
+// is allowed on.
+static bool LinkAllowsPrefetch() {
+  nsresult rv;
+  nsCOMPtr<nsINetworkLinkService> netLinkSvc =
+      do_GetService(NS_NETWORK_LINK_SERVICE_CONTRACTID, &rv);
+  if (NS_FAILED(rv)) {
+    return true;
+  }
+
+  uint32_t linkType;
+  rv = netLinkSvc->GetLinkType(&linkType);
+  if (NS_FAILED(rv)) {
+    return true;
+  }
+
+  return linkType == nsINetworkLinkService::LINK_TYPE_UNKNOWN ||
+         linkType == nsINetworkLinkService::LINK_TYPE_ETHERNET ||
+         linkType == nsINetworkLinkService::LINK_TYPE_USB ||
+         linkType == nsINetworkLinkService::LINK_TYPE_WIFI;
+}
+
 // Runs predictions that have been set up.
 bool Predictor::RunPredictions(nsIURI* referrer,
                                const OriginAttributes& originAttributes,
@@ -1318,6 +1342,12 @@ bool Predictor::RunPredictions(nsIURI* referrer,
   Telemetry::AutoCounter<Telemetry::PREDICTOR_TOTAL_PRERESOLVES>
       totalPreresolves;
 
+  if (!prefetches.IsEmpty() && !LinkAllowsPrefetch()) {
+    PREDICTOR_LOG(("    skipping %zu prefetches on a metered link",
+                   prefetches.Length()));
+    prefetches.Clear();
+  }
+
   len = prefetches.Length();
   for (i = 0; i < len; ++i) {
     PREDICTOR_LOG(("    doing prefetch"));
@@ -25,7 +25,7 @@
 
 #define kMinUnwrittenChanges 300
 #define kMinDumpInterval 20000  // in milliseconds
-#define kMaxBufSize 16384
+#define kMaxBufSize 65536
 #define kIndexVersion 0x00000008
 #define kUpdateIndexStartDelay 50000  // in milliseconds
 #define kTelemetryReportBytesLimit (2U * 1024U * 1024U * 1024U)  // 2GB
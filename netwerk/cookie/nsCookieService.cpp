@@ -2196,9 +2196,14 @@ void nsCookieService::SetCookieStringInternal(
   // check default prefs
   uint32_t priorCookieCount = 0;
   uint32_t rejectedReason = aRejectedReason;
-  nsAutoCString hostFromURI;
-  aHostURI->GetHost(hostFromURI);
-  CountCookiesFromHost(hostFromURI, &priorCookieCount);
+  if (aIsForeign && cookieSettings->GetCookieBehavior() ==
+                        nsICookieService::BEHAVIOR_LIMIT_FOREIGN) {
+    // CheckPrefs only needs the count for this case, and computing it costs
+    // a host normalization, an eTLD lookup and a hash lookup.
+    nsAutoCString hostFromURI;
+    aHostURI->GetHost(hostFromURI);
+    CountCookiesFromHost(hostFromURI, &priorCookieCount);
+  }
   CookieStatus cookieStatus =
       CheckPrefs(cookieSettings, aHostURI, aIsForeign, aIsTrackingResource,
                  aFirstPartyStorageAccessGranted, aCookieHeader,
@@ -3021,7 +3026,10 @@ void nsCookieService::GetCookiesForURI(
   // check default prefs
   uint32_t rejectedReason = aRejectedReason;
   uint32_t priorCookieCount = 0;
-  CountCookiesFromHost(hostFromURI, &priorCookieCount);
+  if (aIsForeign && cookieSettings->GetCookieBehavior() ==
+                        nsICookieService::BEHAVIOR_LIMIT_FOREIGN) {
+    CountCookiesFromHost(hostFromURI, &priorCookieCount);
+  }
   CookieStatus cookieStatus =
       CheckPrefs(cookieSettings, aHostURI, aIsForeign, aIsTrackingResource,
                  aFirstPartyStorageAccessGranted, VoidCString(),
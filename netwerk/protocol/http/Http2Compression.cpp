@@ -771,6 +771,11 @@ nsresult Http2Decompressor::CopyHuffmanStringFromInput(uint32_t bytes,
   nsresult rv;
   uint8_t c;
 
+  // The shortest code in the HPACK Huffman table is 5 bits, so this bounds
+  // the decoded length and saves regrowing buf one character at a time for
+  // long values like cookies.
+  buf.SetCapacity(bytes * 8 / 5);
+
   while (bytesRead < bytes) {
     uint32_t bytesConsumed = 0;
     rv = DecodeHuffmanCharacter(&HuffmanIncomingRoot, c, bytesConsumed,
@@ -10147,7 +10147,15 @@ nsresult nsHttpChannel::MaybeRaceCacheWithNetwork() {
     return NS_OK;
   }
 
-  if (CacheFileUtils::CachePerfStats::IsCacheSlow()) {
+  // Opens issued behind a long CacheIOThread queue are the ones
+  // OnCacheEntryAvailable reports as slow, and they are filtered out of the
+  // ENTRY_OPEN average used below. Don't give the cache a head start we
+  // already expect it to miss.
+  bool queueIsLong = mCacheOpenWithPriority
+                         ? mCacheQueueSizeWhenOpen >= sRCWNQueueSizePriority
+                         : mCacheQueueSizeWhenOpen >= sRCWNQueueSizeNormal;
+
+  if (queueIsLong || CacheFileUtils::CachePerfStats::IsCacheSlow()) {
     // If the cache is slow, trigger the network request immediately.
     mRaceDelay = 0;
   } else {
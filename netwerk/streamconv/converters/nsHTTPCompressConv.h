@@ -14,6 +14,7 @@
 #  include "nsAutoPtr.h"
 #  include "mozilla/Atomics.h"
 #  include "mozilla/Mutex.h"
+#  include "mozilla/UniquePtr.h"
 
 #  include "zlib.h"
 
@@ -73,6 +74,10 @@ class BrotliWrapper {
   nsIRequest* mRequest;
   nsISupports* mContext;
   uint64_t mSourceOffset;
+
+  // Decompression output buffer, allocated on first use and kept for the
+  // lifetime of the stream rather than once per OnDataAvailable.
+  UniquePtr<uint8_t[]> mOutBuffer;
 };
 
 class nsHTTPCompressConv : public nsIStreamConverter,
@@ -7,6 +7,7 @@
 #include "nsHtml5TreeOperation.h"
 #include "mozAutoDocUpdate.h"
 #include "mozilla/Likely.h"
+#include "mozilla/Unused.h"
 #include "mozilla/dom/Comment.h"
 #include "mozilla/dom/DocumentType.h"
 #include "mozilla/dom/Element.h"
@@ -296,6 +297,9 @@ nsresult nsHtml5TreeOperation::AddAttributes(nsIContent* aNode,
 void nsHtml5TreeOperation::SetHTMLElementAttributes(
     dom::Element* aElement, nsAtom* aName, nsHtml5HtmlAttributes* aAttributes) {
   int32_t len = aAttributes->getLength();
+  // This is only an allocation hint; SetAttr below still grows the storage
+  // if this fails.
+  Unused << aElement->EnsureAttrCapacityFromParser(len);
   for (int32_t i = 0; i < len; i++) {
     nsHtml5String val = aAttributes->getValueNoBoundsCheck(i);
     nsAtom* klass = val.MaybeAsAtom();
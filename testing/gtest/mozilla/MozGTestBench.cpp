@@ -5,16 +5,99 @@
 
 #include "MozGTestBench.h"
 #include "mozilla/TimeStamp.h"
+#include <algorithm>
 #include <stdio.h>
 #include <string>
 #include <vector>
 
+#if defined(XP_LINUX) && !defined(ANDROID)
+#  include <linux/perf_event.h>
+#  include <string.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#  define MOZ_GTEST_BENCH_PERF_COUNTERS
+#endif
+
 #define MOZ_GTEST_BENCH_FRAMEWORK "platform_microbench"
 #define MOZ_GTEST_NUM_ITERATIONS 5
 
 using mozilla::TimeStamp;
 
 namespace mozilla {
+
+#if !defined(DEBUG) && !defined(MOZ_ASAN)
+
+#  ifdef MOZ_GTEST_BENCH_PERF_COUNTERS
+// A hardware counter for this thread, read around each iteration when
+// MOZ_GTEST_BENCH_PERF_COUNTERS is set in the environment.  Opening it fails
+// harmlessly when perf events aren't available (e.g. perf_event_paranoid).
+class PerfCounter {
+ public:
+  explicit PerfCounter(uint64_t aConfig) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = aConfig;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    mFd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+  }
+
+  ~PerfCounter() {
+    if (mFd >= 0) {
+      close(mFd);
+    }
+  }
+
+  bool IsValid() const { return mFd >= 0; }
+
+  void Start() {
+    ioctl(mFd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(mFd, PERF_EVENT_IOC_ENABLE, 0);
+  }
+
+  int64_t Stop() {
+    ioctl(mFd, PERF_EVENT_IOC_DISABLE, 0);
+    uint64_t count = 0;
+    if (read(mFd, &count, sizeof(count)) != sizeof(count)) {
+      return 0;
+    }
+    return int64_t(count);
+  }
+
+ private:
+  int mFd;
+};
+#  endif
+
+// Formats one perfherder subtest, reporting the median of aValues.
+static std::string FormatSubtest(const std::string& aName,
+                                 std::vector<int64_t>& aValues,
+                                 bool aShouldAlert) {
+  std::string replicatesStr = "[" + std::to_string(aValues[0]);
+  for (size_t i = 1; i < aValues.size(); i++) {
+    replicatesStr += "," + std::to_string(aValues[i]);
+  }
+  replicatesStr += "]";
+
+  // median is at index floor(i/2) if number of replicates is odd,
+  // (i/2-1) if even
+  std::sort(aValues.begin(), aValues.end());
+  int medianIndex =
+      (aValues.size() / 2) + ((aValues.size() % 2 == 0) ? (-1) : 0);
+
+  return "{\"name\": \"" + aName +
+         "\", \"value\": " + std::to_string(aValues[medianIndex]) +
+         ", \"replicates\": " + replicatesStr +
+         ", \"lowerIsBetter\": true, \"shouldAlert\": " +
+         (aShouldAlert ? "true" : "false") + "}";
+}
+
+#endif
+
 void GTestBench(const char* aSuite, const char* aName,
                 const std::function<void()>& aTest) {
 #if defined(DEBUG) || defined(MOZ_ASAN)
@@ -23,37 +106,52 @@ void GTestBench(const char* aSuite, const char* aName,
   aTest();
 #else
   bool shouldAlert = bool(getenv("PERFHERDER_ALERTING_ENABLED"));
-  std::vector<int> durations;
+  std::vector<int64_t> durations;
+
+#  ifdef MOZ_GTEST_BENCH_PERF_COUNTERS
+  bool recordCounters = bool(getenv("MOZ_GTEST_BENCH_PERF_COUNTERS"));
+  PerfCounter cycles(PERF_COUNT_HW_CPU_CYCLES);
+  PerfCounter cacheMisses(PERF_COUNT_HW_CACHE_MISSES);
+  recordCounters = recordCounters && cycles.IsValid() && cacheMisses.IsValid();
+  std::vector<int64_t> cycleCounts, cacheMissCounts;
+#  endif
 
   for (int i = 0; i < MOZ_GTEST_NUM_ITERATIONS; i++) {
+#  ifdef MOZ_GTEST_BENCH_PERF_COUNTERS
+    if (recordCounters) {
+      cycles.Start();
+      cacheMisses.Start();
+    }
+#  endif
     mozilla::TimeStamp start = TimeStamp::Now();
 
     aTest();
 
     durations.push_back((TimeStamp::Now() - start).ToMicroseconds());
+#  ifdef MOZ_GTEST_BENCH_PERF_COUNTERS
+    if (recordCounters) {
+      cycleCounts.push_back(cycles.Stop());
+      cacheMissCounts.push_back(cacheMisses.Stop());
+    }
+#  endif
   }
 
-  std::string replicatesStr = "[" + std::to_string(durations[0]);
-  for (int i = 1; i < MOZ_GTEST_NUM_ITERATIONS; i++) {
-    replicatesStr += "," + std::to_string(durations[i]);
+  std::string subtests = FormatSubtest(aName, durations, shouldAlert);
+#  ifdef MOZ_GTEST_BENCH_PERF_COUNTERS
+  // The counters are noisier than wall-clock time, so they never alert.
+  if (recordCounters) {
+    subtests += ", " + FormatSubtest(std::string(aName) + "-cycles",
+                                     cycleCounts, false);
+    subtests += ", " + FormatSubtest(std::string(aName) + "-cache-misses",
+                                     cacheMissCounts, false);
   }
-  replicatesStr += "]";
-
-  // median is at index floor(i/2) if number of replicates is odd,
-  // (i/2-1) if even
-  std::sort(durations.begin(), durations.end());
-  int medianIndex =
-      (MOZ_GTEST_NUM_ITERATIONS / 2) + ((durations.size() % 2 == 0) ? (-1) : 0);
+#  endif
 
   // Print the result for each test. Let perfherder aggregate for us
   printf(
       "PERFHERDER_DATA: {\"framework\": {\"name\": \"%s\"}, "
-      "\"suites\": [{\"name\": \"%s\", \"subtests\": "
-      "[{\"name\": \"%s\", \"value\": %i, \"replicates\": %s, "
-      "\"lowerIsBetter\": true, \"shouldAlert\": %s}]"
-      "}]}\n",
-      MOZ_GTEST_BENCH_FRAMEWORK, aSuite, aName, durations[medianIndex],
-      replicatesStr.c_str(), shouldAlert ? "true" : "false");
+      "\"suites\": [{\"name\": \"%s\", \"subtests\": [%s]}]}\n",
+      MOZ_GTEST_BENCH_FRAMEWORK, aSuite, subtests.c_str());
 #endif
 }
 
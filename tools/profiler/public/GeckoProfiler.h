@@ -155,7 +155,11 @@ class Vector;
     MACRO(12, "trackopts", TrackOptimizations,                                \
           "Have the JavaScript engine track JIT optimizations")               \
                                                                               \
-    MACRO(13, "jstracer", JSTracer, "Enable tracing of the JavaScript engine")
+    MACRO(13, "jstracer", JSTracer,                                           \
+          "Enable tracing of the JavaScript engine")                          \
+                                                                              \
+    MACRO(14, "nostacksampling", NoStackSampling,                             \
+          "Record markers and counters only, without sampling thread stacks")
 
 struct ProfilerFeature {
 #  define DECLARE(n_, str_, Name_, desc_)                     \
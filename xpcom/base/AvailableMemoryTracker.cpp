@@ -347,7 +347,9 @@ void nsJemallocFreeDirtyPagesRunnable::OptimizeSystemHeap() {
 /**
  * The memory pressure watcher is used for listening to memory-pressure events
  * and reacting upon them. We use one instance per process currently only for
- * cleaning up dirty unused pages held by jemalloc.
+ * cleaning up dirty unused pages held by jemalloc. The same cleanup is also
+ * scheduled, at idle priority, once the user stops interacting with us, so
+ * that dirty pages don't linger in processes that have gone quiet.
  */
 class nsMemoryPressureWatcher final : public nsIObserver {
   ~nsMemoryPressureWatcher() {}
@@ -371,20 +373,28 @@ void nsMemoryPressureWatcher::Init() {
 
   if (os) {
     os->AddObserver(this, "memory-pressure", /* ownsWeak */ false);
+    os->AddObserver(this, "user-interaction-inactive", /* ownsWeak */ false);
   }
 }
 
 /**
  * Reacts to all types of memory-pressure events, launches a runnable to
- * free dirty pages held by jemalloc.
+ * free dirty pages held by jemalloc. When the user goes inactive the same
+ * runnable is queued as an idle task instead, since nothing is urgent then.
  */
 NS_IMETHODIMP
 nsMemoryPressureWatcher::Observe(nsISupports* aSubject, const char* aTopic,
                                  const char16_t* aData) {
-  MOZ_ASSERT(!strcmp(aTopic, "memory-pressure"), "Unknown topic");
-
   nsCOMPtr<nsIRunnable> runnable = new nsJemallocFreeDirtyPagesRunnable();
 
+  if (strcmp(aTopic, "user-interaction-inactive") == 0) {
+    NS_DispatchToCurrentThreadQueue(runnable.forget(),
+                                    EventQueuePriority::Idle);
+    return NS_OK;
+  }
+
+  MOZ_ASSERT(!strcmp(aTopic, "memory-pressure"), "Unknown topic");
+
   NS_DispatchToMainThread(runnable);
 
   return NS_OK;
@@ -211,7 +211,9 @@ class nsAtomSubTable {
 // subtables.
 class nsAtomTable {
  public:
+  nsAtomTable();
   nsAtomSubTable& SelectSubTable(AtomTableKey& aKey);
+  nsStaticAtom* LookupStaticAtom(AtomTableKey& aKey) const;
   void AddSizeOfIncludingThis(MallocSizeOf aMallocSizeOf, AtomsSizes& aSizes);
   void GC(GCKind aKind);
   already_AddRefed<nsAtom> Atomize(const nsAString& aUTF16String);
@@ -261,6 +263,13 @@ class nsAtomTable {
 
  private:
   nsAtomSubTable mSubTables[kNumSubTables];
+
+  // Static atoms live in their own table rather than in the subtables. It is
+  // only modified by RegisterStaticAtoms() during startup, before other
+  // threads can atomize, so it can be searched without taking any lock. Since
+  // a dynamic atom can never have the same string as a static atom, a hit here
+  // is final and a miss means the subtables need to be checked.
+  PLDHashTable mStaticAtoms;
 };
 
 // Static singleton instance for the atom table.
@@ -317,8 +326,25 @@ static const PLDHashTableOps AtomTableOps = {
 // Rounding down to the nearest power of two gives us 8192 / N. Since the
 // capacity is double the initial length, we end up with (4096 / N) per
 // subtable.
+//
+// Static atoms are now kept in nsAtomTable::mStaticAtoms rather than the
+// subtables, but the dynamic atoms created during startup reach a similar
+// count, so the same sizing still works.
 #define INITIAL_SUBTABLE_LENGTH (4096 / nsAtomTable::kNumSubTables)
 
+nsAtomTable::nsAtomTable()
+    : mStaticAtoms(&AtomTableOps, sizeof(AtomTableEntry),
+                   nsGkAtoms::sAtomsLen) {}
+
+nsStaticAtom* nsAtomTable::LookupStaticAtom(AtomTableKey& aKey) const {
+  auto he = static_cast<AtomTableEntry*>(mStaticAtoms.Search(&aKey));
+  if (!he) {
+    return nullptr;
+  }
+  MOZ_ASSERT(he->mAtom->IsStatic());
+  return static_cast<nsStaticAtom*>(he->mAtom);
+}
+
 nsAtomSubTable& nsAtomTable::SelectSubTable(AtomTableKey& aKey) {
   // There are a few considerations around how we select subtables.
   //
@@ -346,6 +372,7 @@ void nsAtomTable::AddSizeOfIncludingThis(MallocSizeOf aMallocSizeOf,
                                          AtomsSizes& aSizes) {
   MOZ_ASSERT(NS_IsMainThread());
   aSizes.mTable += aMallocSizeOf(this);
+  aSizes.mTable += mStaticAtoms.ShallowSizeOfExcludingThis(aMallocSizeOf);
   for (auto& table : mSubTables) {
     MutexAutoLock lock(table.mLock);
     table.AddSizeOfExcludingThisLocked(aMallocSizeOf, aSizes);
@@ -390,7 +417,7 @@ void nsAtomTable::GC(GCKind aKind) {
 size_t nsAtomTable::RacySlowCount() {
   // Trigger a GC so that the result is deterministic modulo other threads.
   GC(GCKind::RegularOperation);
-  size_t count = 0;
+  size_t count = mStaticAtoms.EntryCount();
   for (auto& table : mSubTables) {
     MutexAutoLock lock(table.mLock);
     count += table.mTable.EntryCount();
@@ -522,9 +549,10 @@ void nsAtomTable::RegisterStaticAtoms(const nsStaticAtom* aAtoms,
     AtomTableKey key(atom);
     nsAtomSubTable& table = SelectSubTable(key);
     MutexAutoLock lock(table.mLock);
-    AtomTableEntry* he = table.Add(key);
+    auto he = static_cast<AtomTableEntry*>(mStaticAtoms.Add(&key));
+    AtomTableEntry* dynamic = table.Search(key);
 
-    if (he->mAtom) {
+    if (he->mAtom || dynamic) {
       // There are two ways we could get here.
       // - Register two static atoms with the same string.
       // - Create a dynamic atom and then register a static atom with the same
@@ -532,7 +560,7 @@ void nsAtomTable::RegisterStaticAtoms(const nsStaticAtom* aAtoms,
       // Both cases can cause subtle bugs, and are disallowed. We're
       // programming in C++ here, not Smalltalk.
       nsAutoCString name;
-      he->mAtom->ToUTF8String(name);
+      (he->mAtom ? he->mAtom : dynamic->mAtom)->ToUTF8String(name);
       MOZ_CRASH_UNSAFE_PRINTF("Atom for '%s' already exists", name.get());
     }
     he->mAtom = const_cast<nsStaticAtom*>(atom);
@@ -555,6 +583,10 @@ already_AddRefed<nsAtom> nsAtomTable::Atomize(const nsACString& aUTF8String) {
     CopyUTF8toUTF16(aUTF8String, str);
     return Atomize(str);
   }
+  if (nsStaticAtom* atom = LookupStaticAtom(key)) {
+    return do_AddRef(atom);
+  }
+
   nsAtomSubTable& table = SelectSubTable(key);
   MutexAutoLock lock(table.mLock);
   AtomTableEntry* he = table.Add(key);
@@ -585,6 +617,10 @@ already_AddRefed<nsAtom> NS_Atomize(const char16_t* aUTF16String) {
 
 already_AddRefed<nsAtom> nsAtomTable::Atomize(const nsAString& aUTF16String) {
   AtomTableKey key(aUTF16String.Data(), aUTF16String.Length());
+  if (nsStaticAtom* atom = LookupStaticAtom(key)) {
+    return do_AddRef(atom);
+  }
+
   nsAtomSubTable& table = SelectSubTable(key);
   MutexAutoLock lock(table.mLock);
   AtomTableEntry* he = table.Add(key);
@@ -617,17 +653,21 @@ already_AddRefed<nsAtom> nsAtomTable::AtomizeMainThread(
     return retVal.forget();
   }
 
-  nsAtomSubTable& table = SelectSubTable(key);
-  MutexAutoLock lock(table.mLock);
-  AtomTableEntry* he = table.Add(key);
-
-  if (he->mAtom) {
-    retVal = he->mAtom;
+  if (nsStaticAtom* atom = LookupStaticAtom(key)) {
+    retVal = atom;
   } else {
-    RefPtr<nsAtom> newAtom =
-        dont_AddRef(nsDynamicAtom::Create(aUTF16String, key.mHash));
-    he->mAtom = newAtom;
-    retVal = newAtom.forget();
+    nsAtomSubTable& table = SelectSubTable(key);
+    MutexAutoLock lock(table.mLock);
+    AtomTableEntry* he = table.Add(key);
+
+    if (he->mAtom) {
+      retVal = he->mAtom;
+    } else {
+      RefPtr<nsAtom> newAtom =
+          dont_AddRef(nsDynamicAtom::Create(aUTF16String, key.mHash));
+      he->mAtom = newAtom;
+      retVal = newAtom.forget();
+    }
   }
 
   p.Set(retVal);
@@ -654,11 +694,7 @@ nsStaticAtom* NS_GetStaticAtom(const nsAString& aUTF16String) {
 
 nsStaticAtom* nsAtomTable::GetStaticAtom(const nsAString& aUTF16String) {
   AtomTableKey key(aUTF16String.Data(), aUTF16String.Length());
-  nsAtomSubTable& table = SelectSubTable(key);
-  MutexAutoLock lock(table.mLock);
-  AtomTableEntry* he = table.Search(key);
-  return he && he->mAtom->IsStatic() ? static_cast<nsStaticAtom*>(he->mAtom)
-                                     : nullptr;
+  return LookupStaticAtom(key);
 }
 
 void ToLowerCaseASCII(RefPtr<nsAtom>& aAtom) {
@@ -102,6 +102,9 @@ bool nsTArray_base<Alloc, Copy>::UsesAutoArrayBuffer() const {
 bool IsTwiceTheRequiredBytesRepresentableAsUint32(size_t aCapacity,
                                                   size_t aElemSize);
 
+// defined in nsTArray.cpp
+size_t nsTArray_GoodAllocSize(size_t aSize);
+
 template <class Alloc, class Copy>
 template <typename ActualAlloc>
 typename ActualAlloc::ResultTypeProxy
@@ -139,26 +142,35 @@ nsTArray_base<Alloc, Copy>::EnsureCapacity(size_type aCapacity,
 
   size_t reqSize = sizeof(Header) + aCapacity * aElemSize;
 
+  // We increase our capacity so that the allocated buffer grows exponentially,
+  // which gives us amortized O(1) appending. Below the threshold, we use
+  // powers-of-two. Above the threshold, we grow by at least 1.125, rounding up
+  // to the nearest MiB.
+  const size_t slowGrowthThreshold = 8 * 1024 * 1024;
+
   if (mHdr == EmptyHdr()) {
-    // Malloc() new data
-    Header* header = static_cast<Header*>(ActualAlloc::Malloc(reqSize));
+    // Malloc() new data. The allocator rounds the request up to its size
+    // class anyway, so ask for that much and use the slop for extra capacity,
+    // which often saves the first reallocation.
+    size_t bytesToAlloc = reqSize;
+    size_t capacity = aCapacity;
+    if (reqSize < slowGrowthThreshold) {
+      bytesToAlloc = nsTArray_GoodAllocSize(reqSize);
+      capacity = (bytesToAlloc - sizeof(Header)) / aElemSize;
+    }
+
+    Header* header = static_cast<Header*>(ActualAlloc::Malloc(bytesToAlloc));
     if (!header) {
       return ActualAlloc::FailureResult();
     }
     header->mLength = 0;
-    header->mCapacity = aCapacity;
+    header->mCapacity = capacity;
     header->mIsAutoArray = 0;
     mHdr = header;
 
     return ActualAlloc::SuccessResult();
   }
 
-  // We increase our capacity so that the allocated buffer grows exponentially,
-  // which gives us amortized O(1) appending. Below the threshold, we use
-  // powers-of-two. Above the threshold, we grow by at least 1.125, rounding up
-  // to the nearest MiB.
-  const size_t slowGrowthThreshold = 8 * 1024 * 1024;
-
   size_t bytesToAlloc;
   if (reqSize >= slowGrowthThreshold) {
     size_t currSize = sizeof(Header) + Capacity() * aElemSize;
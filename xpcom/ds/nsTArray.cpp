@@ -10,6 +10,9 @@
 #include "nsDebug.h"
 #include "mozilla/CheckedInt.h"
 #include "mozilla/IntegerPrintfMacros.h"
+#ifdef MOZ_MEMORY
+#  include "mozmemory.h"
+#endif
 
 // Ensure this is sufficiently aligned so that Elements() and co don't create
 // unaligned pointers, or slices with unaligned pointers for empty arrays, see
@@ -22,6 +25,14 @@ bool IsTwiceTheRequiredBytesRepresentableAsUint32(size_t aCapacity,
   return ((CheckedUint32(aCapacity) * aElemSize) * 2).isValid();
 }
 
+size_t nsTArray_GoodAllocSize(size_t aSize) {
+#ifdef MOZ_MEMORY
+  return malloc_good_size(aSize);
+#else
+  return aSize;
+#endif
+}
+
 MOZ_NORETURN MOZ_COLD void InvalidArrayIndex_CRASH(size_t aIndex,
                                                    size_t aLength) {
   MOZ_CRASH_UNSAFE_PRINTF(
@@ -312,8 +312,23 @@ static nsresult T_EscapeURL(const typename T::char_type* aPart, size_t aPartLen,
   typename T::char_type tempBuffer[100];
   unsigned int tempBufferPos = 0;
 
+  // Most input is already escaped. Skip the leading run of ASCII characters
+  // that the loop below would pass through untouched, without its
+  // per-character bookkeeping; if nothing needs escaping we never append.
+  size_t i = 0;
+  if (!writing && !aFilterMask) {
+    for (; i < aPartLen; ++i) {
+      unsigned_char_type c = src[i];
+      if (c > 0x7f || !dontNeedEscape(c, aFlags) || (c == ':' && colon) ||
+          (c == ' ' && spaces)) {
+        break;
+      }
+    }
+    src += i;
+  }
+
   bool previousIsNonASCII = false;
-  for (size_t i = 0; i < aPartLen; ++i) {
+  for (; i < aPartLen; ++i) {
     unsigned_char_type c = *src++;
 
     // If there is a filter, we wish to skip any characters which match it.
@@ -7,6 +7,7 @@
 #include "nsTArray.h"
 #include "gtest/gtest.h"
 #include "mozilla/ArrayUtils.h"
+#include "gtest/MozGTestBench.h"  // For MOZ_GTEST_BENCH
 
 using namespace mozilla;
 
@@ -43,6 +44,50 @@ struct Movable {
   uint32_t* mDestructionCounter;
 };
 
+TEST(TArray, FirstAllocationCapacity)
+{
+  // The first heap allocation may round the capacity up to the allocator's
+  // size class, but never below what was asked for, and the extra space must
+  // be usable without reallocating.
+  for (size_t requested = 1; requested < 100; requested++) {
+    nsTArray<uint8_t> array;
+    array.SetCapacity(requested);
+    ASSERT_GE(array.Capacity(), requested);
+
+    const uint8_t* elements = array.Elements();
+    array.SetLength(array.Capacity());
+    ASSERT_EQ(array.Elements(), elements);
+  }
+}
+
+static const uint32_t kBenchLength = 100000;
+
+MOZ_GTEST_BENCH(TArray, PerfAppendElement, [] {
+  nsTArray<uint32_t> array;
+  for (uint32_t i = 0; i < kBenchLength; i++) {
+    array.AppendElement(i);
+  }
+  MOZ_RELEASE_ASSERT(array.Length() == kBenchLength);
+});
+
+MOZ_GTEST_BENCH(TArray, PerfInsertElementSorted, [] {
+  nsTArray<uint32_t> array;
+  for (uint32_t i = 0; i < kBenchLength / 10; i++) {
+    array.InsertElementSorted((i * 2654435761u) % kBenchLength);
+  }
+  MOZ_RELEASE_ASSERT(array.Length() == kBenchLength / 10);
+});
+
+MOZ_GTEST_BENCH(TArray, PerfSort, [] {
+  nsTArray<uint32_t> array;
+  array.SetCapacity(kBenchLength);
+  for (uint32_t i = 0; i < kBenchLength; i++) {
+    array.AppendElement((i * 2654435761u) % kBenchLength);
+  }
+  array.Sort();
+  MOZ_RELEASE_ASSERT(array[0] <= array[kBenchLength - 1]);
+});
+
 }  // namespace TestTArray
 
 template <>
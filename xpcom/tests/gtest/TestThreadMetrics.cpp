@@ -181,3 +181,24 @@ TEST_F(ThreadMetrics, CollectRecursiveMetrics) {
   // let's make sure we don't count the time spent in recursive calls
   ASSERT_LT(duration, 300000u);
 }
+
+TEST_F(ThreadMetrics, CollectCPUTime) {
+  nsresult rv;
+  initScheduler();
+
+  // Dispatching a runnable that will sleep for +50ms
+  rv = Dispatch(25, 25, 0);
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+
+  // Flush the queue
+  ProcessAllEvents();
+
+  // The execution should be in the ring buffer
+  PerformanceCounter::RecentExecutions samples;
+  ASSERT_EQ(mCounter->GetRecentExecutions(samples), 1u);
+  ASSERT_GE(samples[0].mDuration, 50000u);
+
+  // sleeping doesn't use the CPU
+  ASSERT_LT(samples[0].mCPUTime, samples[0].mDuration);
+  ASSERT_EQ(mCounter->GetExecutionCPUTime(), samples[0].mCPUTime);
+}
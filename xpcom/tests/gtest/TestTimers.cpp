@@ -16,6 +16,7 @@
 #include "mozilla/Attributes.h"
 
 #include "mozilla/ReentrantMonitor.h"
+#include "mozilla/TimeStamp.h"
 
 #include <list>
 #include <vector>
@@ -143,6 +144,72 @@ TEST(Timers, TimerWithStoppedTarget)
   PR_Sleep(400);
 }
 
+class FiredAtCallback final : public nsITimerCallback {
+ public:
+  NS_DECL_THREADSAFE_ISUPPORTS
+
+  explicit FiredAtCallback(ReentrantMonitor* aReentrantMonitor)
+      : mReentrantMonitor(aReentrantMonitor) {}
+
+  NS_IMETHOD Notify(nsITimer* aTimer) override {
+    ReentrantMonitorAutoEnter mon(*mReentrantMonitor);
+    mFiredAt = TimeStamp::Now();
+    mon.Notify();
+    return NS_OK;
+  }
+
+  TimeStamp FiredAt() const { return mFiredAt; }
+
+ private:
+  ~FiredAtCallback() {}
+
+  ReentrantMonitor* mReentrantMonitor;
+  TimeStamp mFiredAt;
+};
+
+NS_IMPL_ISUPPORTS(FiredAtCallback, nsITimerCallback)
+
+TEST(Timers, TimerAddedDuringCoalescedWait)
+{
+  AutoCreateAndDestroyReentrantMonitor newMon;
+  ASSERT_TRUE(newMon);
+
+  AutoTestThread testThread;
+  ASSERT_TRUE(testThread);
+
+  nsIEventTarget* target = static_cast<nsIEventTarget*>(testThread);
+
+  // A low priority timer makes the timer thread put off waking up until
+  // 100ms after it is due.
+  RefPtr<FiredAtCallback> lowPriorityCallback = new FiredAtCallback(newMon);
+  nsCOMPtr<nsITimer> lowPriorityTimer;
+  nsresult rv = NS_NewTimerWithCallback(
+      getter_AddRefs(lowPriorityTimer), lowPriorityCallback, 1000,
+      nsITimer::TYPE_ONE_SHOT_LOW_PRIORITY, target);
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+
+  // Give the timer thread a chance to start its coalesced wait.
+  PR_Sleep(PR_MillisecondsToInterval(100));
+
+  // This timer is due after the low priority one, but before the coalesced
+  // wakeup, and must not wait for it.
+  RefPtr<FiredAtCallback> callback = new FiredAtCallback(newMon);
+  TimeStamp deadline = TimeStamp::Now() + TimeDuration::FromMilliseconds(920);
+  nsCOMPtr<nsITimer> timer;
+  rv = NS_NewTimerWithCallback(getter_AddRefs(timer), callback, 920,
+                               nsITimer::TYPE_ONE_SHOT, target);
+  ASSERT_TRUE(NS_SUCCEEDED(rv));
+
+  ReentrantMonitorAutoEnter mon(*newMon);
+  while (callback->FiredAt().IsNull()) {
+    mon.Wait();
+  }
+  EXPECT_LT((callback->FiredAt() - deadline).ToMilliseconds(), 60.0)
+      << "Timer waited for the coalesced wakeup";
+
+  lowPriorityTimer->Cancel();
+}
+
 // gtest on 32bit Win7 debug build is unstable and somehow this test
 // makes it even worse.
 #if !defined(XP_WIN) || !defined(DEBUG) || defined(HAVE_64BIT_BUILD)
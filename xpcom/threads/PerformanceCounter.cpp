@@ -8,6 +8,15 @@
 #include "mozilla/Logging.h"
 #include "mozilla/PerformanceCounter.h"
 
+#if defined(XP_WIN)
+#  include <windows.h>
+#elif defined(XP_MACOSX)
+#  include <mach/mach.h>
+#  include <pthread.h>
+#else
+#  include <time.h>
+#endif
+
 static mozilla::LazyLogModule sPerformanceCounter("PerformanceCounter");
 #ifdef LOG
 #  undef LOG
@@ -30,6 +39,9 @@ const DispatchCategory DispatchCategory::Worker =
 
 PerformanceCounter::PerformanceCounter(const nsACString& aName)
     : mExecutionDuration(0),
+      mExecutionCPUTime(0),
+      mRecentExecutions(),
+      mRecordedExecutionCount(0),
       mTotalDispatchCount(0),
       mDispatchCounter(),
       mName(aName),
@@ -50,6 +62,16 @@ void PerformanceCounter::IncrementExecutionDuration(uint32_t aMicroseconds) {
        uint64_t(mExecutionDuration)));
 }
 
+void PerformanceCounter::IncrementExecutionDuration(uint32_t aMicroseconds,
+                                                    uint32_t aCPUMicroseconds) {
+  IncrementExecutionDuration(aMicroseconds);
+  mExecutionCPUTime += aCPUMicroseconds;
+
+  uint64_t index = mRecordedExecutionCount++;
+  mRecentExecutions[index % kRecentExecutionCount] =
+      (uint64_t(aMicroseconds) << 32) | aCPUMicroseconds;
+}
+
 const DispatchCounter& PerformanceCounter::GetDispatchCounter() {
   return mDispatchCounter;
 }
@@ -58,6 +80,58 @@ uint64_t PerformanceCounter::GetExecutionDuration() {
   return mExecutionDuration;
 }
 
+uint64_t PerformanceCounter::GetExecutionCPUTime() { return mExecutionCPUTime; }
+
+uint32_t PerformanceCounter::GetRecentExecutions(RecentExecutions& aSamples) {
+  uint64_t recorded = mRecordedExecutionCount;
+  uint32_t count = recorded < kRecentExecutionCount ? uint32_t(recorded)
+                                                     : kRecentExecutionCount;
+  for (uint32_t i = 0; i < count; i++) {
+    uint64_t packed =
+        mRecentExecutions[(recorded - 1 - i) % kRecentExecutionCount];
+    aSamples[i].mDuration = uint32_t(packed >> 32);
+    aSamples[i].mCPUTime = uint32_t(packed);
+  }
+  return count;
+}
+
+/* static */
+uint64_t PerformanceCounter::GetCurrentThreadCPUTime() {
+#if defined(XP_WIN)
+  // GetThreadTimes() reports in 100ns units, but is only updated on each
+  // clock tick.
+  FILETIME creationTime, exitTime, kernelTime, userTime;
+  if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime,
+                      &kernelTime, &userTime)) {
+    return 0;
+  }
+  uint64_t kernel = (uint64_t(kernelTime.dwHighDateTime) << 32) |
+                    kernelTime.dwLowDateTime;
+  uint64_t user =
+      (uint64_t(userTime.dwHighDateTime) << 32) | userTime.dwLowDateTime;
+  return (kernel + user) / 10;
+#elif defined(XP_MACOSX)
+  thread_basic_info_data_t info;
+  mach_msg_type_number_t count = THREAD_BASIC_INFO_COUNT;
+  if (thread_info(pthread_mach_thread_np(pthread_self()), THREAD_BASIC_INFO,
+                  reinterpret_cast<thread_info_t>(&info),
+                  &count) != KERN_SUCCESS) {
+    return 0;
+  }
+  return uint64_t(info.user_time.seconds + info.system_time.seconds) *
+             1000000 +
+         info.user_time.microseconds + info.system_time.microseconds;
+#elif defined(CLOCK_THREAD_CPUTIME_ID)
+  struct timespec ts;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+    return 0;
+  }
+  return uint64_t(ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+#else
+  return 0;
+#endif
+}
+
 uint64_t PerformanceCounter::GetTotalDispatchCount() {
   return mTotalDispatchCount;
 }
@@ -62,10 +62,25 @@ typedef Array<Atomic<uint32_t>, (uint32_t)TaskCategory::Count + 1>
 // recursivity. If an event triggers a recursive call to
 // nsThread::ProcessNextEVent, the counter will discard the time
 // spent in sub events.
+//
+// Along with the wall clock duration, nsThread measures the CPU time
+// the thread spent in each runnable, and the counter keeps the most
+// recent of those measurements in a fixed-size ring buffer, so that
+// consumers can sample where the time goes without running the
+// profiler.
 class PerformanceCounter final {
  public:
   NS_INLINE_DECL_THREADSAFE_REFCOUNTING(PerformanceCounter)
 
+  // A single runnable execution, in microseconds.
+  struct ExecutionSample {
+    uint32_t mDuration;
+    uint32_t mCPUTime;
+  };
+
+  static const uint32_t kRecentExecutionCount = 64;
+  typedef Array<ExecutionSample, kRecentExecutionCount> RecentExecutions;
+
   explicit PerformanceCounter(const nsACString& aName);
 
   /**
@@ -85,6 +100,14 @@ class PerformanceCounter final {
    */
   void IncrementExecutionDuration(uint32_t aMicroseconds);
 
+  /**
+   * Same as above, also accounting for the CPU time the thread spent
+   * running the runnable, and recording the execution in the ring
+   * buffer returned by GetRecentExecutions().
+   */
+  void IncrementExecutionDuration(uint32_t aMicroseconds,
+                                  uint32_t aCPUMicroseconds);
+
   /**
    * Returns a category/counter array of all dispatches.
    */
@@ -95,6 +118,27 @@ class PerformanceCounter final {
    */
   uint64_t GetExecutionDuration();
 
+  /**
+   * Returns the total CPU time of the executions recorded with
+   * their CPU time.
+   */
+  uint64_t GetExecutionCPUTime();
+
+  /**
+   * Fills aSamples with the most recent executions, newest first,
+   * and returns how many were filled in.
+   *
+   * This can run concurrently with the thread recording executions,
+   * in which case a sample may be newer than its position suggests.
+   */
+  uint32_t GetRecentExecutions(RecentExecutions& aSamples);
+
+  /**
+   * Returns the CPU time used by the current thread so far, in
+   * microseconds, or 0 if the platform can't tell.
+   */
+  static uint64_t GetCurrentThreadCPUTime();
+
   /**
    * Returns the number of dispatches per TaskCategory.
    */
@@ -122,6 +166,10 @@ class PerformanceCounter final {
   ~PerformanceCounter() {}
 
   Atomic<uint64_t> mExecutionDuration;
+  Atomic<uint64_t> mExecutionCPUTime;
+  // Each entry packs an ExecutionSample, duration in the high bits.
+  Array<Atomic<uint64_t>, kRecentExecutionCount> mRecentExecutions;
+  Atomic<uint64_t> mRecordedExecutionCount;
   Atomic<uint64_t> mTotalDispatchCount;
   DispatchCounter mDispatchCounter;
   nsCString mName;
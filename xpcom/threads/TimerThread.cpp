@@ -18,6 +18,7 @@
 #include "mozilla/ArrayUtils.h"
 #include "mozilla/BinarySearch.h"
 #include "mozilla/OperatorNewExtensions.h"
+#include "mozilla/Telemetry.h"
 
 #include <math.h>
 
@@ -343,6 +344,12 @@ nsresult TimerThread::Shutdown() {
 
 namespace {
 
+// Low priority timers may fire up to a tenth of their delay late, capped at
+// kMaxLowPriorityTimerToleranceMs, so that the timer thread can wake up once
+// for a whole group of them.
+const int64_t kLowPriorityTimerToleranceDivisor = 10;
+const double kMaxLowPriorityTimerToleranceMs = 100.0;
+
 struct MicrosecondsToInterval {
   PRIntervalTime operator[](size_t aMs) const {
     return PR_MicrosecondsToInterval(aMs);
@@ -383,9 +390,25 @@ TimerThread::Run() {
   mAllowedEarlyFiringMicroseconds = usIntervalResolution / 2;
   bool forceRunNextTimer = false;
 
+  // When we've put off waking up to coalesce timer firings, this is the time
+  // we would otherwise have woken up at. Timers firing after it would each
+  // have woken the thread up separately.
+  TimeStamp uncoalescedWakeup;
+  uint32_t wakeupsSaved = 0;
+
   while (!mShutdown) {
+    if (wakeupsSaved) {
+      uint32_t saved = wakeupsSaved;
+      wakeupsSaved = 0;
+      MonitorAutoUnlock unlock(mMonitor);
+      Telemetry::ScalarAdd(Telemetry::ScalarID::TIMERS_WAKEUPS_COALESCED,
+                           saved);
+    }
+
     // Have to use PRIntervalTime here, since PR_WaitCondVar takes it
     TimeDuration waitFor;
+    TimeStamp intendedWakeup;
+    TimeStamp nextUncoalescedWakeup;
     bool forceRunThisTimer = forceRunNextTimer;
     forceRunNextTimer = false;
 
@@ -411,6 +434,11 @@ TimerThread::Run() {
           // must be racing with us, blocked in gThread->RemoveTimer waiting
           // for TimerThread::mMonitor, under nsTimerImpl::Release.
 
+          if (!uncoalescedWakeup.IsNull() &&
+              mTimers[0]->Timeout() > uncoalescedWakeup) {
+            ++wakeupsSaved;
+          }
+
           RefPtr<nsTimerImpl> timerRef(mTimers[0]->Take());
           RemoveFirstTimerInternal();
 
@@ -457,7 +485,13 @@ TimerThread::Run() {
       RemoveLeadingCanceledTimersInternal();
 
       if (!mTimers.IsEmpty()) {
-        TimeStamp timeout = mTimers[0]->Value()->mTimeout;
+        TimeStamp timeout = CoalescedWakeupInternal();
+        if (timeout > mTimers[0]->Timeout()) {
+          nextUncoalescedWakeup = mTimers[0]->Timeout();
+        } else {
+          timeout = mTimers[0]->Value()->mTimeout;
+        }
+        intendedWakeup = timeout;
 
         // Don't wait at all (even for PR_INTERVAL_NO_WAIT) if the next timer
         // is due now or overdue.
@@ -501,9 +535,12 @@ TimerThread::Run() {
 
     mWaiting = true;
     mNotified = false;
+    mIntendedWakeupTime = intendedWakeup;
+    uncoalescedWakeup = nextUncoalescedWakeup;
     mMonitor.Wait(waitFor);
     if (mNotified) {
       forceRunNextTimer = false;
+      uncoalescedWakeup = TimeStamp();
     }
     mWaiting = false;
   }
@@ -528,8 +565,12 @@ nsresult TimerThread::AddTimer(nsTimerImpl* aTimer) {
     return NS_ERROR_OUT_OF_MEMORY;
   }
 
-  // Awaken the timer thread.
-  if (mWaiting && mTimers[0]->Value() == aTimer) {
+  // Awaken the timer thread if the new timer is due before the time it is
+  // about to wake up at. That may be later than the first timer's timeout when
+  // we are coalescing wakeups.
+  if (mWaiting && (mTimers[0]->Value() == aTimer ||
+                   (!mIntendedWakeupTime.IsNull() &&
+                    aTimer->mTimeout < mIntendedWakeupTime))) {
     mNotified = true;
     mMonitor.Notify();
   }
@@ -638,8 +679,16 @@ bool TimerThread::AddTimerInternal(nsTimerImpl* aTimer) {
 
   TimeStamp now = TimeStamp::Now();
 
+  TimeDuration tolerance;
+  if (aTimer->IsLowPriority()) {
+    tolerance = std::min(
+        aTimer->mDelay / kLowPriorityTimerToleranceDivisor,
+        TimeDuration::FromMilliseconds(kMaxLowPriorityTimerToleranceMs));
+  }
+
   UniquePtr<Entry>* entry = mTimers.AppendElement(
-      MakeUnique<Entry>(now, aTimer->mTimeout, aTimer), mozilla::fallible);
+      MakeUnique<Entry>(now, aTimer->mTimeout, tolerance, aTimer),
+      mozilla::fallible);
   if (!entry) {
     return false;
   }
@@ -690,6 +739,35 @@ void TimerThread::RemoveLeadingCanceledTimersInternal() {
                            mTimers.end() - sortedEnd);
 }
 
+// Returns the latest time we can wake up at while still firing every timer no
+// later than it allows. mTimers[0] must not be canceled.
+TimeStamp TimerThread::CoalescedWakeupInternal() const {
+  mMonitor.AssertCurrentThreadOwns();
+  MOZ_ASSERT(!mTimers.IsEmpty() && mTimers[0]->Value());
+
+  // mTimers is a heap ordered by Timeout(), and LatestWakeup() is never
+  // earlier than Timeout(), so we can skip every subtree whose root times out
+  // no earlier than the wakeup we've found so far. That keeps this walk to
+  // the timers inside the coalescing window.
+  TimeStamp wakeup = mTimers[0]->LatestWakeup();
+  AutoTArray<size_t, 32> pending;
+  pending.AppendElement(1);
+  pending.AppendElement(2);
+  while (!pending.IsEmpty()) {
+    size_t index = pending.LastElement();
+    pending.RemoveLastElement();
+    if (index >= mTimers.Length() || mTimers[index]->Timeout() >= wakeup) {
+      continue;
+    }
+    if (mTimers[index]->Value()) {
+      wakeup = std::min(wakeup, mTimers[index]->LatestWakeup());
+    }
+    pending.AppendElement(2 * index + 1);
+    pending.AppendElement(2 * index + 2);
+  }
+  return wakeup;
+}
+
 void TimerThread::RemoveFirstTimerInternal() {
   mMonitor.AssertCurrentThreadOwns();
   MOZ_ASSERT(!mTimers.IsEmpty());
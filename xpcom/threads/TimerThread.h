@@ -67,6 +67,7 @@ class TimerThread final : public nsIRunnable, public nsIObserver {
   bool RemoveTimerInternal(nsTimerImpl* aTimer);
   void RemoveLeadingCanceledTimersInternal();
   void RemoveFirstTimerInternal();
+  TimeStamp CoalescedWakeupInternal() const;
   nsresult Init();
 
   already_AddRefed<nsTimerImpl> PostTimerEvent(
@@ -79,15 +80,23 @@ class TimerThread final : public nsIRunnable, public nsIObserver {
   bool mWaiting;
   bool mNotified;
   bool mSleeping;
+  // When the timer thread is waiting, the time it intends to wake up at, or
+  // null if it is waiting for a notification.
+  TimeStamp mIntendedWakeupTime;
 
   class Entry final : public nsTimerImplHolder {
     const TimeStamp mTimeout;
+    // The latest time at which the timer thread may wake up to fire this
+    // timer. Later than mTimeout for timers that tolerate firing late, so
+    // that their firing can be coalesced with that of other timers.
+    const TimeStamp mLatestWakeup;
 
    public:
     Entry(const TimeStamp& aMinTimeout, const TimeStamp& aTimeout,
-          nsTimerImpl* aTimerImpl)
+          const TimeDuration& aTolerance, nsTimerImpl* aTimerImpl)
         : nsTimerImplHolder(aTimerImpl),
-          mTimeout(std::max(aMinTimeout, aTimeout)) {}
+          mTimeout(std::max(aMinTimeout, aTimeout)),
+          mLatestWakeup(mTimeout + aTolerance) {}
 
     nsTimerImpl* Value() const { return mTimerImpl; }
 
@@ -106,6 +115,7 @@ class TimerThread final : public nsIRunnable, public nsIObserver {
     }
 
     TimeStamp Timeout() const { return mTimeout; }
+    TimeStamp LatestWakeup() const { return mLatestWakeup; }
   };
 
   nsTArray<mozilla::UniquePtr<Entry>> mTimers;
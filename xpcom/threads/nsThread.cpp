@@ -1175,8 +1175,11 @@ nsThread::ProcessNextEvent(bool aMayWait, bool* aResult) {
         // This is a recursive call, we're saving the time
         // spent in the parent event if the runnable is linked to a DocGroup.
         mozilla::TimeDuration duration = TimeStamp::Now() - mCurrentEventStart;
+        uint64_t cpuTime =
+            mozilla::PerformanceCounter::GetCurrentThreadCPUTime() -
+            mCurrentEventCPUStart;
         mCurrentPerformanceCounter->IncrementExecutionDuration(
-            duration.ToMicroseconds());
+            duration.ToMicroseconds(), cpuTime);
       }
 
 #ifdef MOZ_COLLECTING_RUNNABLE_TELEMETRY
@@ -1221,6 +1224,10 @@ nsThread::ProcessNextEvent(bool aMayWait, bool* aResult) {
       mCurrentEvent = event;
       mCurrentPerformanceCounter = GetPerformanceCounter(event);
       currentPerformanceCounter = mCurrentPerformanceCounter;
+      if (currentPerformanceCounter) {
+        mCurrentEventCPUStart =
+            mozilla::PerformanceCounter::GetCurrentThreadCPUTime();
+      }
 
       event->Run();
 
@@ -1253,13 +1260,20 @@ nsThread::ProcessNextEvent(bool aMayWait, bool* aResult) {
         // so the parent gets its remaining execution time right.
         mCurrentEventStart = mozilla::TimeStamp::Now();
         mCurrentPerformanceCounter = currentPerformanceCounter;
+        if (currentPerformanceCounter) {
+          mCurrentEventCPUStart =
+              mozilla::PerformanceCounter::GetCurrentThreadCPUTime();
+        }
       } else {
         // We're done with this dispatch
         if (currentPerformanceCounter) {
           mozilla::TimeDuration duration =
               TimeStamp::Now() - mCurrentEventStart;
+          uint64_t cpuTime =
+              mozilla::PerformanceCounter::GetCurrentThreadCPUTime() -
+              mCurrentEventCPUStart;
           currentPerformanceCounter->IncrementExecutionDuration(
-              duration.ToMicroseconds());
+              duration.ToMicroseconds(), cpuTime);
         }
         mCurrentEvent = nullptr;
         mCurrentEventLoopDepth = MaxValue<uint32_t>::value;
@@ -242,6 +242,9 @@ class nsThread : public nsIThreadInternal,
   nsCOMPtr<nsIRunnable> mCurrentEvent;
 
   mozilla::TimeStamp mCurrentEventStart;
+  // Thread CPU time at mCurrentEventStart, only sampled when the current event
+  // has a PerformanceCounter.
+  uint64_t mCurrentEventCPUStart = 0;
   mozilla::TimeStamp mNextIdleDeadline;
 
 #ifdef EARLY_BETA_OR_EARLIER
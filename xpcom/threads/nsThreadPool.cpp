@@ -12,6 +12,7 @@
 #include "nsThread.h"
 #include "nsMemory.h"
 #include "nsAutoPtr.h"
+#include "nsISupportsPriority.h"
 #include "prinrval.h"
 #include "mozilla/Logging.h"
 #include "mozilla/SystemGroup.h"
@@ -30,6 +31,8 @@ static LazyLogModule sThreadPoolLog("nsThreadPool");
 //  o  Use nsThreadPool::Run as the main routine for each thread.
 //  o  Each thread waits on the event queue's monitor, checking for
 //     pending events and rescheduling itself as an idle thread.
+//  o  Events implementing nsISupportsPriority are queued by priority, so
+//     urgent work doesn't wait behind bulk work dispatched earlier.
 
 #define DEFAULT_THREAD_LIMIT 4
 #define DEFAULT_IDLE_THREAD_LIMIT 1
@@ -69,6 +72,16 @@ nsresult nsThreadPool::PutEvent(nsIRunnable* aEvent) {
 
 nsresult nsThreadPool::PutEvent(already_AddRefed<nsIRunnable> aEvent,
                                 uint32_t aFlags) {
+  nsCOMPtr<nsIRunnable> event(aEvent);
+
+  // Look up the priority before taking the lock, to keep the QI out of the
+  // critical section that every dispatching and worker thread contends on.
+  int32_t priority = nsISupportsPriority::PRIORITY_NORMAL;
+  if (nsCOMPtr<nsISupportsPriority> supportsPriority =
+          do_QueryInterface(event)) {
+    supportsPriority->GetPriority(&priority);
+  }
+
   // Avoid spawning a new thread while holding the event queue lock...
 
   bool spawnThread = false;
@@ -88,11 +101,18 @@ nsresult nsThreadPool::PutEvent(already_AddRefed<nsIRunnable> aEvent,
         !(aFlags & NS_DISPATCH_AT_END) &&
         // Spawn a new thread if we don't have enough idle threads to serve
         // pending events immediately.
-        mEvents.Count(lock) >= mIdleCount) {
+        PendingEventCount(lock) >= mIdleCount) {
       spawnThread = true;
     }
 
-    mEvents.PutEvent(std::move(aEvent), EventQueuePriority::Normal, lock);
+    // nsISupportsPriority values are lower for more urgent work.
+    EventQueue& queue =
+        priority < nsISupportsPriority::PRIORITY_NORMAL
+            ? mHighPriorityEvents
+            : priority > nsISupportsPriority::PRIORITY_NORMAL
+                  ? mLowPriorityEvents
+                  : mEvents;
+    queue.PutEvent(event.forget(), EventQueuePriority::Normal, lock);
     mEventsAvailable.Notify();
     stackSize = mStackSize;
   }
@@ -135,6 +155,23 @@ nsresult nsThreadPool::PutEvent(already_AddRefed<nsIRunnable> aEvent,
   return NS_OK;
 }
 
+already_AddRefed<nsIRunnable> nsThreadPool::GetEvent(
+    const MutexAutoLock& aLock) {
+  if (nsCOMPtr<nsIRunnable> event =
+          mHighPriorityEvents.GetEvent(nullptr, aLock)) {
+    return event.forget();
+  }
+  if (nsCOMPtr<nsIRunnable> event = mEvents.GetEvent(nullptr, aLock)) {
+    return event.forget();
+  }
+  return mLowPriorityEvents.GetEvent(nullptr, aLock);
+}
+
+size_t nsThreadPool::PendingEventCount(const MutexAutoLock& aLock) const {
+  return mHighPriorityEvents.Count(aLock) + mEvents.Count(aLock) +
+         mLowPriorityEvents.Count(aLock);
+}
+
 void nsThreadPool::ShutdownThread(nsIThread* aThread) {
   LOG(("THRD-P(%p) shutdown async [%p]\n", this, aThread));
 
@@ -180,7 +217,7 @@ nsThreadPool::Run() {
     {
       MutexAutoLock lock(mMutex);
 
-      event = mEvents.GetEvent(nullptr, lock);
+      event = GetEvent(lock);
       if (!event) {
         TimeStamp now = TimeStamp::Now();
         uint32_t idleTimeoutDivider =
@@ -34,11 +34,18 @@ class nsThreadPool final : public nsIThreadPool, public nsIRunnable {
   void ShutdownThread(nsIThread* aThread);
   nsresult PutEvent(nsIRunnable* aEvent);
   nsresult PutEvent(already_AddRefed<nsIRunnable> aEvent, uint32_t aFlags);
+  already_AddRefed<nsIRunnable> GetEvent(const mozilla::MutexAutoLock& aLock);
+  size_t PendingEventCount(const mozilla::MutexAutoLock& aLock) const;
 
   nsCOMArray<nsIThread> mThreads;
   mozilla::Mutex mMutex;
   mozilla::CondVar mEventsAvailable;
+  // Events whose nsISupportsPriority priority is above normal are run before
+  // all other pending events, and events whose priority is below normal are
+  // only run once nothing else is pending.
+  mozilla::EventQueue mHighPriorityEvents;
   mozilla::EventQueue mEvents;
+  mozilla::EventQueue mLowPriorityEvents;
   uint32_t mThreadLimit;
   uint32_t mIdleThreadLimit;
   uint32_t mIdleThreadTimeout;